@@ -0,0 +1,107 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "./include/arena.hpp"
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// Every object is preceded by a header that tells where it was allocated; the header also keeps the 16-byte alignment.
+static const size_t headerSize = 16;
+static const size_t blockSize = 256 * 1024;
+
+struct Blocks : public std::vector<char*> {
+    ~Blocks() {for(size_t i=0; i<size(); i++) std::free((*this)[i]);}
+};
+
+struct Pool {
+    Blocks blocks;
+    char* current = nullptr;
+    size_t left = 0;
+};
+
+static thread_local bool active = false;
+
+// The pool of the current compilation and the pool that lives as long as the thread
+static thread_local Pool compilation;
+static thread_local Pool persistent;
+static thread_local Pool* pool = &compilation;
+
+void* Arena::allocate(size_t size) {
+    size_t total = headerSize + ((size + 15) & ~(size_t)15);
+    char* memory;
+
+    if(!active) {
+        memory = (char*)std::malloc(total);
+        if(memory == nullptr) throw std::bad_alloc();
+        memory[0] = 0;
+        return memory + headerSize;
+    }
+
+    if(pool->left < total) {
+        size_t newSize = (total > blockSize) ? total : blockSize;
+        char* block = (char*)std::malloc(newSize);
+        if(block == nullptr) throw std::bad_alloc();
+
+        // Oversized objects get their own block; the current block stays in use
+        if(total > blockSize) {
+            pool->blocks.insert(pool->blocks.begin(), block);
+            block[0] = 1;
+            return block + headerSize;
+        }
+
+        pool->blocks.push_back(block);
+        pool->current = block;
+        pool->left = blockSize;
+    }
+
+    memory = pool->current;
+    pool->current += total;
+    pool->left -= total;
+    memory[0] = 1;
+    return memory + headerSize;
+}
+
+void Arena::deallocate(void* ptr) {
+    if(ptr == nullptr) return;
+    char* memory = (char*)ptr - headerSize;
+    if(memory[0] == 0) std::free(memory);
+}
+
+// Starts placing the new objects in the arena.
+void Arena::begin() {active = true;}
+
+bool Arena::isActive() {return active;}
+
+// Releases all objects of the compilation. The last block is kept for the next compilation.
+void Arena::reset() {
+    active = false;
+    pool = &compilation;
+    if(compilation.blocks.empty()) return;
+
+    char* last = compilation.blocks.back();
+    for(size_t i=0; i<compilation.blocks.size() - 1; i++) std::free(compilation.blocks[i]);
+    compilation.blocks.clear();
+
+    // The oversized blocks are placed in front, so the last block is the current one unless there are only oversized blocks
+    if(compilation.current >= last && compilation.current <= last + blockSize) {
+        compilation.blocks.push_back(last);
+        compilation.current = last;
+        compilation.left = blockSize;
+    }
+    else {
+        std::free(last);
+        compilation.current = nullptr;
+        compilation.left = 0;
+    }
+}
+
+Arena::Persistent::Persistent() {
+    previous = pool;
+    pool = &persistent;
+}
+
+Arena::Persistent::~Persistent() {pool = (Pool*)previous;}
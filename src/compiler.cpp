@@ -11,12 +11,18 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "./include/parser/nodes/NodeInt.hpp"
 #include "./include/parser/nodes/NodeImport.hpp"
 #include "./include/parser/nodes/NodeRet.hpp"
+#include "./include/arena.hpp"
+#include "./include/timetrace.hpp"
+#include "./include/jit.hpp"
 #include <iostream>
 #include <fstream>
 #include <chrono>
 #include <ctime>
 #include <regex>
+#include <thread>
+#include <atomic>
 #include "./include/lexer/lexer.hpp"
+#include "./include/lexer/source.hpp"
 #include "./include/parser/parser.hpp"
 #include <llvm-c/Target.h>
 #include <llvm-c/TargetMachine.h>
@@ -27,23 +33,33 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <llvm-c/OrcEE.h>
 #include <llvm-c/Transforms/PassBuilder.h>
+#include <llvm-c/Support.h>
 
 #include <llvm-c/Remarks.h>
 #include <llvm-c/Linker.h>
-
-#if LLVM_VERSION < 17
-#include <llvm-c/Transforms/InstCombine.h>
-#include <llvm-c/Transforms/Utils.h>
-#include <llvm-c/Transforms/Vectorize.h>
-#include <llvm-c/Transforms/PassManagerBuilder.h>
-#include <llvm-c/Transforms/IPO.h>
-#include <llvm-c/Transforms/Scalar.h>
-#endif
+#include <llvm-c/BitReader.h>
+#include <llvm-c/BitWriter.h>
 
 #include <llvm-c/Target.h>
 
+#ifndef __has_include
+  static_assert(false, "__has_include not supported");
+#else
+#if __cplusplus >= 201703L && __has_include(<filesystem>)
+#include <filesystem>
+    namespace fs = std::filesystem;
+#elif __has_include(<experimental/filesystem>)
+#    include <experimental/filesystem>
+    namespace fs = std::experimental::filesystem;
+#elif __has_include(<boost/filesystem.hpp>)
+#include <boost/filesystem.hpp>
+    namespace fs = boost::filesystem;
+#  endif
+#endif
+
 #ifdef _WIN32
    #include <io.h>
+   #include <process.h>
    #define access    _access_s
    #define WEXITSTATUS(w) (((w) >> 8) & 0377)
 #else
@@ -55,16 +71,18 @@ std::string Compiler::linkString;
 std::string Compiler::outFile;
 std::string Compiler::outType;
 std::string Compiler::features;
+std::set<std::string> Compiler::emittedTemplates;
 genSettings Compiler::settings;
 nlohmann::json Compiler::options;
-double Compiler::lexTime = 0.0;
-double Compiler::parseTime = 0.0;
-double Compiler::genTime = 0.0;
+thread_local double Compiler::lexTime = 0.0;
+thread_local double Compiler::parseTime = 0.0;
+thread_local double Compiler::genTime = 0.0;
 std::vector<std::string> Compiler::files;
 std::vector<std::string> Compiler::toImport;
 bool Compiler::debugMode;
 std::string Compiler::ravePlatform;
 std::string Compiler::raveOs;
+thread_local Compiler::Job* Compiler::currentJob = nullptr;
 
 
 std::string getDirectory(std::string file) {
@@ -155,9 +173,130 @@ void Compiler::loadPlatformVars() {
     }
 }
 
+std::ostream& Compiler::log() {
+    if(Compiler::currentJob != nullptr) return Compiler::currentJob->log;
+    return std::cout;
+}
+
+void Compiler::exit(int status) {
+    if(Compiler::currentJob != nullptr) throw JobFailure{status};
+    std::exit(status);
+}
+
+LLVMTargetMachineRef createTargetMachine() {
+    char* errors = nullptr;
+    LLVMTargetRef target;
+    char* triple = LLVMNormalizeTargetTriple(Compiler::outType.c_str());
+
+    LLVMGetTargetFromTriple(triple, &target, &errors);
+    if(errors != nullptr) {
+        Compiler::error("target from triple \"" + std::string(triple) + "\": " + std::string(errors));
+        std::exit(1);
+    }
+    else LLVMDisposeErrorMessage(errors);
+
+    // With -native the scheduling model of the host CPU is used too, not only its features
+    char* cpu = Compiler::settings.isNative ? LLVMGetHostCPUName() : nullptr;
+
+    LLVMTargetMachineRef machine = LLVMCreateTargetMachine(
+		target,
+		triple,
+		(cpu != nullptr) ? cpu : Compiler::settings.cpu.c_str(),
+		Compiler::features.c_str(),
+		LLVMCodeGenLevelDefault,
+        (Compiler::settings.isPIC ? LLVMRelocPIC : LLVMRelocDynamicNoPic),
+	LLVMCodeModelDefault);
+
+    if(cpu != nullptr) LLVMDisposeMessage(cpu);
+    LLVMDisposeMessage(triple);
+    return machine;
+}
+
+// Emits the object code into memory and writes it with a single write
+void emitObject(LLVMTargetMachineRef machine, LLVMModuleRef module, std::string const& outputObj) {
+    TimeTrace::Scope scope("EmitObject", outputObj);
+    char* errors = nullptr;
+    LLVMMemoryBufferRef buffer = nullptr;
+
+    if(LLVMTargetMachineEmitToMemoryBuffer(machine, module, LLVMObjectFile, &errors, &buffer)) {
+        Compiler::error("target machine emit to memory buffer: " + std::string(errors != nullptr ? errors : ""));
+        std::exit(1);
+    }
+
+    std::ofstream fObject(outputObj, std::ios::binary);
+    fObject.write(LLVMGetBufferStart(buffer), LLVMGetBufferSize(buffer));
+    LLVMDisposeMemoryBuffer(buffer);
+
+    if(!fObject) {
+        Compiler::error("cannot write the object file '" + outputObj + "'!");
+        std::exit(1);
+    }
+}
+
+// Name of the optimization level in the pipelines of the new pass manager: O0-O3, Os or Oz
+static std::string optLevelName() {
+    if(Compiler::settings.sizeLevel == 1) return "Os";
+    if(Compiler::settings.sizeLevel == 2) return "Oz";
+    return "O" + std::to_string(Compiler::settings.optLevel);
+}
+
+// Runs the pipeline of the new pass manager on the module; a wrong custom pipeline (--passes) stops the compilation
+static void runPasses(LLVMTargetMachineRef machine, LLVMModuleRef module, std::string const& passes) {
+    // The same tuning as clang: the vectorizers and unrolling from -O2, but no loop vectorization at -Oz
+    LLVMErrorRef error = LLVM::runPasses(
+        module, passes, machine,
+        Compiler::settings.optLevel >= 2 && Compiler::settings.sizeLevel < 2, Compiler::settings.optLevel >= 2, Compiler::settings.optLevel >= 2
+    );
+
+    if(error != nullptr) {
+        char* message = LLVMGetErrorMessage(error);
+        std::string text = message;
+        LLVMDisposeErrorMessage(message);
+        Compiler::error("cannot run the passes '" + passes + "': " + text);
+        std::exit(1);
+    }
+}
+
+// Runs the LTO pipeline on the linked program, so functions from different files (including std) can be inlined into each other
+static void optimizeLinked(LLVMTargetMachineRef machine, LLVMModuleRef module) {
+    TimeTrace::Scope scope("OptimizeLinked");
+    runPasses(machine, module, Compiler::settings.passes != "" ? Compiler::settings.passes : "lto<" + optLevelName() + ">");
+}
+
+// Links the bitcode of all jobs into one module and emits it as a single object file
+void Compiler::linkModules(std::vector<std::string> const& modules, std::string const& outputObj) {
+    TimeTrace::Scope scope("LinkModules", outputObj);
+    LLVMContextRef context = LLVMContextCreate();
+    LLVMModuleRef result = nullptr;
+
+    for(size_t i=0; i<modules.size(); i++) {
+        LLVMMemoryBufferRef buffer = LLVMCreateMemoryBufferWithMemoryRange(modules[i].data(), modules[i].size(), "module", false);
+        LLVMModuleRef module;
+
+        if(LLVMParseBitcodeInContext2(context, buffer, &module)) Compiler::error("cannot read the bitcode of a module!");
+        LLVMDisposeMemoryBuffer(buffer);
+
+        if(result == nullptr) result = module;
+        else if(LLVMLinkModules2(result, module)) Compiler::error("cannot link the modules!");
+    }
+
+    if(result != nullptr) {
+        LLVMTargetMachineRef machine = createTargetMachine();
+        if(Compiler::settings.lto && (Compiler::settings.optLevel > 0 || Compiler::settings.passes != "")) optimizeLinked(machine, result);
+        emitObject(machine, result, outputObj);
+        LLVMDisposeTargetMachine(machine);
+        LLVMDisposeModule(result);
+    }
+    LLVMContextDispose(context);
+}
+
+static bool isFeatureEnabled(bool setting, std::string const& name) {
+    return setting && Compiler::options[name].template get<bool>() && (Compiler::ravePlatform == "X86_64" || Compiler::ravePlatform == "X86");
+}
+
 void Compiler::error(std::string message) {
-    std::cout << "\033[0;31mError: "+message+"\033[0;0m\n";
-    std::exit(1);
+    Compiler::log() << "\033[0;31mError: "+message+"\033[0;0m\n";
+    Compiler::exit(1);
 }
 
 void Compiler::initialize(std::string outFile, std::string outType, genSettings settings, std::vector<std::string> files) {
@@ -166,8 +305,6 @@ void Compiler::initialize(std::string outFile, std::string outType, genSettings
     Compiler::settings = settings;
     Compiler::files = files;
 
-    loadPlatformVars();
-    
     if(access((exePath + "options.json").c_str(), 0) == 0) {
         // If file exists - read it
 
@@ -228,6 +365,52 @@ void Compiler::initialize(std::string outFile, std::string outType, genSettings
 
     Compiler::linkString = Compiler::options["compiler"].template get<std::string>() + " ";
 
+    // Called once for all files, after linkString is set, so --target for the Windows targets is kept
+    loadPlatformVars();
+
+    if(!settings.isNative) {
+        bool sse = isFeatureEnabled(settings.sse, "sse");
+        bool sse2 = isFeatureEnabled(settings.sse2, "sse2");
+        bool sse3 = isFeatureEnabled(settings.sse3, "sse3");
+        bool ssse3 = isFeatureEnabled(settings.ssse3, "ssse3");
+        bool sse4a = isFeatureEnabled(settings.sse4a, "sse4a");
+        bool sse4_1 = isFeatureEnabled(settings.sse4_1, "sse4_1");
+        bool sse4_2 = isFeatureEnabled(settings.sse4_2, "sse4_2");
+        bool avx = isFeatureEnabled(settings.avx, "avx");
+        bool avx2 = isFeatureEnabled(settings.avx2, "avx2");
+        bool avx512 = isFeatureEnabled(settings.avx512, "avx512");
+
+        Compiler::features = "";
+        if(sse) Compiler::features += "+sse,";
+        if(sse2) Compiler::features += "+sse2,";
+        if(sse3) Compiler::features += "+sse3,";
+        if(ssse3) Compiler::features += "+ssse3,";
+        if(sse4a) Compiler::features += "+sse4a,";
+        if(sse4_1) Compiler::features += "+sse4.1,";
+        if(sse4_2) Compiler::features += "+sse4.2,+crc32,";
+        if(avx) Compiler::features += "+avx,";
+        if(avx2) Compiler::features += "+avx2,";
+        if(avx512) Compiler::features += "+avx512,";
+
+        if(ravePlatform == "X86_64") Compiler::features += "+64bit,+fma,+f16c,";
+        else if(ravePlatform == "X86") Compiler::features += "+fma,";
+
+        if(Compiler::features.length() > 0) Compiler::features = Compiler::features.substr(0, Compiler::features.length() - 1);
+    }
+    else Compiler::features = std::string(LLVMGetHostCPUFeatures());
+
+    if(Compiler::settings.profileUse != "") {
+        if(access(Compiler::settings.profileUse.c_str(), 0) != 0) {
+            Compiler::error("profile '" + Compiler::settings.profileUse + "' does not exists!");
+            std::exit(1);
+        }
+
+        // The pass 'pgo-instr-use' takes the profile only from this option
+        std::string profileOption = "-pgo-test-profile-file=" + Compiler::settings.profileUse;
+        const char* llvmArguments[] = {"rave", profileOption.c_str()};
+        LLVMParseCommandLineOptions(2, llvmArguments, nullptr);
+    }
+
     if(Compiler::settings.isPIE) linkString += "-fPIE ";
     if(Compiler::settings.noStd) linkString += "-nostdlib ";
     if(Compiler::settings.noEntry) linkString += "--no-entry ";
@@ -288,6 +471,9 @@ void Compiler::initialize(std::string outFile, std::string outType, genSettings
     basicTypes[BasicType::Double] = new TypeBasic(BasicType::Double);
     basicTypes[BasicType::Real] = new TypeBasic(BasicType::Real);
     typeVoid = new TypeVoid();
+
+    // The table of the built-in type names is created here, so its types are not placed in the arena
+    getType("void");
 }
 
 // Clears all possible global variables.
@@ -298,31 +484,53 @@ void Compiler::clearAll() {
     AST::structTable.clear();
     AST::structsNumbers.clear();
     AST::methodTable.clear();
+    AST::funcOverloads.clear();
+    AST::methodOverloads.clear();
     AST::importedFiles.clear();
     AST::aliasTypes.clear();
-    generator->structures.clear();
-    generator->globals.clear();
-    generator->functions.clear();
-    generator->currentBuiltinArg = 0;
-    generator->currBB = nullptr;
+    AST::lambdaTable.clear();
+    // AST::parsed is kept: the parsed imports are in the persistent pool of the arena and are only copied by the files
+    if(generator != nullptr) {
+        generator->structures.clear();
+        generator->globals.clear();
+        generator->functions.clear();
+        generator->toReplace.clear();
+        generator->toReplaceValues.clear();
+        generator->currentBuiltinArg = 0;
+        generator->currBB = nullptr;
+    }
     currScope = nullptr;
+    resetInternedTypes();
+
+    // Every node, type and token of the compilation is released here
+    Arena::reset();
 }
 
-void Compiler::compile(std::string const& file, std::string const& outputObj, std::string const& outputLLVM) {
-    std::ifstream fContent(file);
-    std::string content = "";
+// Runs the optimization passes on the module of a single file; every pass gets its own span in the time trace
+static void optimizeModule(LLVMTargetMachineRef machine, LLVMModuleRef module, std::string const& file) {
+    TimeTrace::Scope scope("Optimize", file);
 
-    char c;
-    while(fContent.get(c)) content += c;
+    // With LTO the module is only prepared here and is optimized after linking, in Compiler::linkModules
+    std::string passes;
+    if(Compiler::settings.lto) passes = (Compiler::settings.optLevel > 0) ? "lto-pre-link<" + optLevelName() + ">" : "";
+    else if(Compiler::settings.passes != "") passes = Compiler::settings.passes;
+    else passes = "default<" + optLevelName() + ">";
 
-    int offset = 0;
-    std::string oldContent = content;
+    // PGO works on the unoptimized IR, so the instrumented and the optimized builds see the same control flow graphs
+    std::string pgo = "";
+    if(Compiler::settings.profileGenerate) pgo = "pgo-instr-gen,instrprof";
+    else if(Compiler::settings.profileUse != "") pgo = "pgo-instr-use";
+    if(pgo != "") passes = (passes != "") ? pgo + "," + passes : pgo;
 
-    loadPlatformVars();
+    if(passes != "") runPasses(machine, module, passes);
+}
 
-    // Note: PowerPC must be rechecked for endianness
+void Compiler::compile(std::string const& file, std::string const& outputObj, std::string const& outputLLVM) {
+    Arena::begin();
+
+    SourceFile content(file);
 
-    bool isX86 = ravePlatform == "X86_64" || ravePlatform == "X86";
+    // Note: PowerPC must be rechecked for endianness
 
     bool bigEndian = (
         ravePlatform == "MIPS64" ||
@@ -331,36 +539,16 @@ void Compiler::compile(std::string const& file, std::string const& outputObj, st
         ravePlatform == "POWERPC"
     );
 
-    bool sse = settings.sse && Compiler::options["sse"].template get<bool>() && isX86;
-    bool sse2 = settings.sse2 && Compiler::options["sse2"].template get<bool>() && isX86;
-    bool sse3 = settings.sse3 && Compiler::options["sse3"].template get<bool>() && isX86;
-    bool ssse3 = settings.ssse3 && Compiler::options["ssse3"].template get<bool>() && isX86;
-    bool sse4a = settings.sse4a && Compiler::options["sse4a"].template get<bool>() && isX86;
-    bool sse4_1 = settings.sse4_1 && Compiler::options["sse4_1"].template get<bool>() && isX86;
-    bool sse4_2 = settings.sse4_2 && Compiler::options["sse4_2"].template get<bool>() && isX86;
-    bool avx = settings.avx && Compiler::options["avx"].template get<bool>() && isX86;
-    bool avx2 = settings.avx2 && Compiler::options["avx2"].template get<bool>() && isX86;
-    bool avx512 = settings.avx512 && Compiler::options["avx512"].template get<bool>() && isX86;
-
-    if(!settings.isNative) {
-        Compiler::features = "";
-        if(sse) Compiler::features += "+sse,";
-        if(sse2) Compiler::features += "+sse2,";
-        if(sse3) Compiler::features += "+sse3,";
-        if(ssse3) Compiler::features += "+ssse3,";
-        if(sse4a) Compiler::features += "+sse4a,";
-        if(sse4_1) Compiler::features += "+sse4.1,";
-        if(sse4_2) Compiler::features += "+sse4.2,";
-        if(avx) Compiler::features += "+avx,";
-        if(avx2) Compiler::features += "+avx2,";
-        if(avx512) Compiler::features += "+avx512,";
-
-        if(ravePlatform == "X86_64") Compiler::features += "+64bit,+fma,+f16c,";
-        else if(ravePlatform == "X86") Compiler::features += "+fma,";
-
-        if(Compiler::features.length() > 0) Compiler::features = Compiler::features.substr(0, Compiler::features.length() - 1);
-    }
-    else Compiler::features = std::string(LLVMGetHostCPUFeatures());
+    bool sse = isFeatureEnabled(settings.sse, "sse");
+    bool sse2 = isFeatureEnabled(settings.sse2, "sse2");
+    bool sse3 = isFeatureEnabled(settings.sse3, "sse3");
+    bool ssse3 = isFeatureEnabled(settings.ssse3, "ssse3");
+    bool sse4a = isFeatureEnabled(settings.sse4a, "sse4a");
+    bool sse4_1 = isFeatureEnabled(settings.sse4_1, "sse4_1");
+    bool sse4_2 = isFeatureEnabled(settings.sse4_2, "sse4_2");
+    bool avx = isFeatureEnabled(settings.avx, "avx");
+    bool avx2 = isFeatureEnabled(settings.avx2, "avx2");
+    bool avx512 = isFeatureEnabled(settings.avx512, "avx512");
 
     AST::aliasTable["__RAVE_PLATFORM"] = new NodeString(ravePlatform, false);
     AST::aliasTable["__RAVE_OS"] = new NodeString(raveOs, false);
@@ -382,7 +570,11 @@ void Compiler::compile(std::string const& file, std::string const& outputObj, st
     AST::mainFile = Compiler::files[0];
 
     auto start = std::chrono::steady_clock::now();
-    Lexer* lexer = new Lexer(content, -1);
+    Lexer* lexer;
+    {
+        TimeTrace::Scope scope("Lex", file);
+        lexer = new Lexer(content.data, content.size, -1);
+    }
     auto end = std::chrono::steady_clock::now();
     Compiler::lexTime += std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 
@@ -394,9 +586,16 @@ void Compiler::compile(std::string const& file, std::string const& outputObj, st
         parser->nodes.push_back(new NodeImport(ImportFile{exePath + "std/memory.rave", true}, {}, -1));
     }
 
-    parser->parseAll();
+    {
+        TimeTrace::Scope scope("Parse", file);
+        parser->parseAll();
+    }
     end = std::chrono::steady_clock::now();
-    for(size_t i=0; i<parser->nodes.size(); i++) parser->nodes[i]->check();
+
+    {
+        TimeTrace::Scope scope("Check", file);
+        for(size_t i=0; i<parser->nodes.size(); i++) parser->nodes[i]->check();
+    }
     Compiler::parseTime += std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 
     start = end;
@@ -404,104 +603,34 @@ void Compiler::compile(std::string const& file, std::string const& outputObj, st
     generator = new LLVMGen(file, Compiler::settings, Compiler::options);
 
     char* errors = nullptr;
-    LLVMTargetRef target;
-    char* triple = LLVMNormalizeTargetTriple(Compiler::outType.c_str());
-    if(errors != nullptr) {
-        Compiler::error("normalize target triple: " + std::string(errors));
-        std::exit(1);
-    }
-    else LLVMDisposeErrorMessage(errors);
+    LLVMTargetMachineRef machine = createTargetMachine();
+    char* triple = LLVMGetTargetMachineTriple(machine);
     LLVMSetTarget(generator->lModule, triple);
-
-    LLVMGetTargetFromTriple(triple, &target, &errors);
-    if(errors != nullptr) {
-        Compiler::error("target from triple \"" + std::string(triple) + "\": " + std::string(errors));
-        std::exit(1);
-    }
-    else LLVMDisposeErrorMessage(errors);
-
-    LLVMTargetMachineRef machine = LLVMCreateTargetMachine(
-		target,
-		triple,
-		"generic",
-		Compiler::features.c_str(),
-		LLVMCodeGenLevelDefault,
-        (Compiler::settings.isPIC ? LLVMRelocPIC : LLVMRelocDynamicNoPic),
-	LLVMCodeModelDefault);
+    LLVMDisposeMessage(triple);
 
     generator->targetData = LLVMCreateTargetDataLayout(machine);
     LLVMSetDataLayout(generator->lModule, LLVMCopyStringRepOfTargetData(generator->targetData));
 
-    for(size_t i=0; i<parser->nodes.size(); i++) parser->nodes[i]->generate();
-
-    #if LLVM_VERSION < 17
-    LLVMPassManagerRef pm = LLVMCreatePassManager();
-
-    if(Compiler::settings.optLevel > 0) {
-        LLVMAddInstructionCombiningPass(pm);
-        LLVMAddStripDeadPrototypesPass(pm);
-
-        if(Compiler::settings.optLevel >= 2) {
-            LLVMAddCFGSimplificationPass(pm);
-	        LLVMAddJumpThreadingPass(pm);
-	        LLVMAddSimplifyLibCallsPass(pm);
-	        LLVMAddTailCallEliminationPass(pm);
-	        LLVMAddCFGSimplificationPass(pm);
-	        LLVMAddReassociatePass(pm);
-	        LLVMAddLoopRotatePass(pm);
-	        LLVMAddLICMPass(pm);
-	        LLVMAddCFGSimplificationPass(pm);
-	        LLVMAddLoopIdiomPass(pm);
-	        LLVMAddLoopDeletionPass(pm);
-	        LLVMAddMergedLoadStoreMotionPass(pm);
-	        LLVMAddMemCpyOptPass(pm);
-	        LLVMAddSCCPPass(pm);
-	        LLVMAddBitTrackingDCEPass(pm);
-            LLVMAddCalledValuePropagationPass(pm);
-            LLVMAddSLPVectorizePass(pm);
-	        LLVMAddLICMPass(pm);
-	        LLVMAddAlignmentFromAssumptionsPass(pm);
-	        LLVMAddStripDeadPrototypesPass(pm);
-            LLVMAddLoopRotatePass(pm);
-            LLVMAddLoopVectorizePass(pm);
-        }
-
-        LLVMAddCFGSimplificationPass(pm);
-        LLVMAddIndVarSimplifyPass(pm);
-        LLVMAddScalarReplAggregatesPass(pm);
-        LLVMAddLoopVectorizePass(pm);
-        LLVMAddConstantMergePass(pm);
-        LLVMAddSLPVectorizePass(pm);
-	    LLVMAddPromoteMemoryToRegisterPass(pm);
-	    LLVMAddMergedLoadStoreMotionPass(pm);
-	    LLVMAddAggressiveDCEPass(pm);
-	    LLVMAddAlwaysInlinerPass(pm);
-	    LLVMAddStripDeadPrototypesPass(pm);
-        LLVMAddCFGSimplificationPass(pm);
-
-        LLVMPassManagerBuilderRef pmb = LLVMPassManagerBuilderCreate();
-        LLVMPassManagerBuilderSetOptLevel(pmb, Compiler::settings.optLevel);
-        LLVMPassManagerBuilderPopulateModulePassManager(pmb, pm);
-    }
-
-    LLVMRunPassManager(pm, generator->lModule);
-    #else
-    LLVMPassBuilderOptionsRef pbOptions = LLVMCreatePassBuilderOptions();
-
-    if(Compiler::settings.optLevel == 1) LLVMRunPasses(generator->lModule, "default<O1>", machine, pbOptions);
-    else if(Compiler::settings.optLevel == 2) LLVMRunPasses(generator->lModule, "default<O2>", machine, pbOptions);
-    else if(Compiler::settings.optLevel == 3) LLVMRunPasses(generator->lModule, "default<O3>", machine, pbOptions);
-
-    LLVMDisposePassBuilderOptions(pbOptions);
-    #endif
+    {
+        TimeTrace::Scope scope("Generate", file);
+        for(size_t i=0; i<parser->nodes.size(); i++) parser->nodes[i]->generate();
+        // The lazy JIT cannot split the modules with ifuncs, so --run keeps only the default variant
+        if(!Compiler::settings.run) for(size_t i=0; i<generator->targetClones.size(); i++) LLVM::makeTargetClones(generator->targetClones[i].first, generator->targetClones[i].second);
+    }
 
-    if(outputObj.size()) {
-        LLVMTargetMachineEmitToFile(machine, generator->lModule, outputObj.c_str(), LLVMObjectFile, &errors);
-        if(errors != nullptr) {
-            Compiler::error("target machine emit to file: " + std::string(errors));
-            std::exit(1);
-        }
+    // The other modules only declare the template instances of this one, so lto-pre-link must not remove their bodies
+    bool pinTemplates = Compiler::settings.lto && Compiler::currentJob != nullptr && !Compiler::currentJob->templates.empty();
+    if(pinTemplates) LLVM::pinFunctions(generator->lModule, Compiler::currentJob->templates);
+    optimizeModule(machine, generator->lModule, file);
+    if(pinTemplates) LLVM::unpinFunctions(generator->lModule, Compiler::currentJob->templates);
+
+    if(Compiler::settings.linkModules && Compiler::currentJob != nullptr) {
+        // The module is linked with the others by Compiler::linkModules; bitcode allows to move it into another LLVMContext
+        LLVMMemoryBufferRef buffer = LLVMWriteBitcodeToMemoryBuffer(generator->lModule);
+        Compiler::currentJob->bitcode = std::string(LLVMGetBufferStart(buffer), LLVMGetBufferSize(buffer));
+        LLVMDisposeMemoryBuffer(buffer);
     }
+    else if(outputObj.size()) emitObject(machine, generator->lModule, outputObj);
     if(outputLLVM.size()) {
         LLVMPrintModuleToFile(generator->lModule, outputLLVM.c_str(), &errors);
         if(errors != nullptr) {
@@ -513,24 +642,230 @@ void Compiler::compile(std::string const& file, std::string const& outputObj, st
     end = std::chrono::steady_clock::now();
     Compiler::genTime += std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 
-    for(size_t i=0; i<AST::importedFiles.size(); i++) {
+    if(Compiler::currentJob != nullptr) {
+        // The results are merged by compileJobs in the order of the jobs
+        Compiler::currentJob->imported = AST::importedFiles;
+        Compiler::currentJob->addToImport = AST::addToImport;
+        AST::addToImport.clear();
+    }
+    else for(size_t i=0; i<AST::importedFiles.size(); i++) {
         if(std::find(Compiler::toImport.begin(), Compiler::toImport.end(), AST::importedFiles[i]) == Compiler::toImport.end()) Compiler::toImport.push_back(AST::importedFiles[i]);
     }
 
     Compiler::clearAll();
 }
 
-void Compiler::compileAll() {
+// FNV-1a, used for the keys of the object cache
+static uint64_t hashString(std::string const& data, uint64_t hash = 14695981039346656037ULL) {
+    for(size_t i=0; i<data.size(); i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static std::string hashToString(uint64_t hash) {
+    char buffer[17];
+    snprintf(buffer, sizeof(buffer), "%016llx", (unsigned long long)hash);
+    return std::string(buffer);
+}
+
+static std::string hashFile(std::string const& file) {
+    std::ifstream fContent(file, std::ios::binary);
+    if(!fContent.is_open()) return "";
+    std::string content((std::istreambuf_iterator<char>(fContent)), std::istreambuf_iterator<char>());
+    return hashToString(hashString(content));
+}
+
+// Everything that changes the generated code besides the sources: Compiler::features is derived from the settings, the options and the host CPU.
+static std::string settingsFingerprint() {
+    genSettings& s = Compiler::settings;
+    std::string data = std::to_string(LLVM_VERSION) + "|" + Compiler::outType + "|" + Compiler::options.dump() + "|" + std::to_string(s.optLevel) + "|" + std::to_string(s.sizeLevel) + "|" + s.passes + "|" + s.cpu + "|" + s.linkParams;
+    bool flags[] = {s.noPrelude, s.runtimeChecks, s.noEntry, s.noStd, s.isPIE, s.isPIC, s.isStatic, s.noChecks, s.sse, s.sse2, s.sse3, s.ssse3,
+                    s.sse4a, s.sse4_1, s.sse4_2, s.avx, s.avx2, s.avx512, s.isNative, s.noFastMath, s.noIoInit, s.disableWarnings, Compiler::debugMode};
+    for(size_t i=0; i<sizeof(flags); i++) data += flags[i] ? '1' : '0';
+
+    // The objects built with a profile are reused only while the profile is the same
+    static const std::string profileHash = (s.profileUse != "") ? hashFile(s.profileUse) : "";
+    data += std::string(s.profileGenerate ? "|pgo-gen" : "") + "|" + profileHash;
+    if(s.isNative) data += std::string("|") + LLVMGetHostCPUName() + "|" + LLVMGetHostCPUFeatures();
+    return hashToString(hashString(data));
+}
+
+// The directory, against which @compileAndLink resolves the relative paths
+static std::string mainDirectory() {
+    return fs::absolute(Compiler::files[0]).parent_path().string();
+}
+
+static std::string cacheEntry(std::string const& file) {
+    std::string path = file;
+    if(fs::exists(file)) path = fs::absolute(file).string();
+    return Compiler::settings.cacheDir + "/" + hashToString(hashString(path + "|" + settingsFingerprint()));
+}
+
+// Restores the job from the object cache if the file and all of its imports are unchanged.
+static bool loadFromCache(Compiler::Job& job) {
+    if(Compiler::settings.noCache || Compiler::settings.recompileStd || job.outputObj.empty() || job.outputLLVM.size()) return false;
+
+    std::string entry = cacheEntry(job.file);
+    if(!fs::exists(entry + ".o") || !fs::exists(entry + ".json")) return false;
+
+    nlohmann::json manifest;
+    try {
+        std::ifstream fManifest(entry + ".json");
+        manifest = nlohmann::json::parse(fManifest);
+
+        for(auto& dep : manifest["hashes"].items()) {
+            if(hashFile(dep.key()) != dep.value().template get<std::string>()) return false;
+        }
+
+        std::string directory = manifest["mainDirectory"].template get<std::string>();
+        if(directory != "" && directory != mainDirectory()) return false;
+
+        std::error_code ec;
+        fs::copy_file(entry + ".o", job.outputObj, fs::copy_options::overwrite_existing, ec);
+        if(ec) return false;
+
+        job.imported = manifest["imported"].template get<std::vector<std::string>>();
+        job.addToImport = manifest["addToImport"].template get<std::vector<std::string>>();
+        job.linkString = manifest["linkString"].template get<std::string>();
+
+        // The warnings and @echo of the compilation are printed again, as if the file was compiled
+        job.log << manifest["log"].template get<std::string>();
+    }
+    catch(nlohmann::json::exception&) {return false;}
+    return true;
+}
+
+static void storeToCache(Compiler::Job& job) {
+    if(Compiler::settings.noCache || job.outputObj.empty() || job.outputLLVM.size()) return;
+
+    std::error_code ec;
+    fs::create_directories(Compiler::settings.cacheDir, ec);
+    if(ec) return;
+
+    nlohmann::json manifest;
+    manifest["hashes"][job.file] = hashFile(job.file);
+    for(size_t i=0; i<job.imported.size(); i++) manifest["hashes"][job.imported[i]] = hashFile(job.imported[i]);
+    manifest["imported"] = job.imported;
+    manifest["addToImport"] = job.addToImport;
+    manifest["linkString"] = job.linkString;
+    manifest["mainDirectory"] = job.usesMainDirectory ? mainDirectory() : "";
+    manifest["log"] = job.log.str();
+
+    // Written under temporary names and renamed, so an interrupted build never leaves a half-written entry.
+    // The names are unique for the thread and the process, so the concurrent builds with the same cache directory do not overwrite them.
+    #ifdef _WIN32
+        int pid = _getpid();
+    #else
+        int pid = getpid();
+    #endif
+
+    std::string entry = cacheEntry(job.file);
+    std::string tmp = entry + "." + std::to_string(pid) + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    fs::copy_file(job.outputObj, tmp + ".o", fs::copy_options::overwrite_existing, ec);
+    if(ec) return;
+    std::ofstream(tmp + ".json") << manifest.dump();
+    fs::rename(tmp + ".o", entry + ".o", ec);
+    fs::rename(tmp + ".json", entry + ".json", ec);
+}
+
+static void runJob(Compiler::Job& job) {
+    TimeTrace::Scope scope("Job", job.file);
+    if(loadFromCache(job)) return;
+
+    Compiler::currentJob = &job;
+    try {
+        Compiler::compile(job.file, job.outputObj, job.outputLLVM);
+        storeToCache(job);
+    }
+    catch(Compiler::JobFailure& failure) {
+        job.status = failure.status;
+        Compiler::clearAll();
+        AST::addToImport.clear();
+    }
+    catch(std::exception& exception) {
+        // Any other exception (bad_alloc, filesystem_error) fails only this job, the others are finished and reported in order
+        job.log << "\033[0;31mError in '" + job.file + "' file: " + exception.what() + "\033[0;0m\n";
+        job.status = 1;
+        Compiler::clearAll();
+        AST::addToImport.clear();
+    }
+    Compiler::currentJob = nullptr;
+}
+
+// Compiles the given jobs using up to settings.jobs threads.
+// Every thread has its own AST tables and LLVM context; the results are merged in the order of the jobs, so the output does not depend on the scheduling.
+void Compiler::compileJobs(std::vector<Job>& jobs) {
+    size_t threads = (Compiler::settings.jobs > 0) ? Compiler::settings.jobs : std::thread::hardware_concurrency();
+    if(threads > jobs.size()) threads = jobs.size();
+
+    if(threads <= 1) for(size_t i=0; i<jobs.size(); i++) {
+        runJob(jobs[i]);
+        Compiler::emittedTemplates.insert(jobs[i].templates.begin(), jobs[i].templates.end());
+    }
+    else {
+        std::atomic<size_t> next(0);
+        std::vector<double> times(threads * 3, 0.0);
+        std::vector<std::thread> workers;
+
+        for(size_t t=0; t<threads; t++) workers.push_back(std::thread([&jobs, &next, &times, t]() {
+            AST::debugMode = Compiler::debugMode;
+            TimeTrace::initializeThread();
+
+            for(size_t i=next++; i<jobs.size(); i=next++) runJob(jobs[i]);
+
+            if(generator != nullptr) {
+                delete generator;
+                generator = nullptr;
+            }
+
+            times[t * 3] = Compiler::lexTime;
+            times[t * 3 + 1] = Compiler::parseTime;
+            times[t * 3 + 2] = Compiler::genTime;
+            TimeTrace::finishThread();
+        }));
+
+        for(size_t t=0; t<threads; t++) workers[t].join();
+
+        for(size_t t=0; t<threads; t++) {
+            Compiler::lexTime += times[t * 3];
+            Compiler::parseTime += times[t * 3 + 1];
+            Compiler::genTime += times[t * 3 + 2];
+        }
+
+        // The instances are shared only between the waves, so the workers never read the set while it changes
+        for(size_t i=0; i<jobs.size(); i++) Compiler::emittedTemplates.insert(jobs[i].templates.begin(), jobs[i].templates.end());
+    }
+
+    for(size_t i=0; i<jobs.size(); i++) {
+        std::cout << jobs[i].log.str() << std::flush;
+        if(jobs[i].status != 0) std::exit(jobs[i].status);
+
+        for(size_t j=0; j<jobs[i].imported.size(); j++) {
+            if(std::find(Compiler::toImport.begin(), Compiler::toImport.end(), jobs[i].imported[j]) == Compiler::toImport.end()) Compiler::toImport.push_back(jobs[i].imported[j]);
+        }
+        AST::addToImport.insert(AST::addToImport.end(), jobs[i].addToImport.begin(), jobs[i].addToImport.end());
+        Compiler::linkString += jobs[i].linkString;
+    }
+}
+
+int Compiler::compileAll() {
     AST::debugMode = Compiler::debugMode;
     std::vector<std::string> toRemove;
+    std::vector<std::string> modules;
+    std::vector<std::string> objects;
+    std::vector<Job> jobs;
 
     for(size_t i=0; i<Compiler::files.size(); i++) {
         if(access(Compiler::files[i].c_str(), 0) != 0) {
             Compiler::error("file '" + Compiler::files[i] + "' does not exists!");
-            return;
+            return 1;
         }
-        if(endsWith(Compiler::files[i], ".a") || endsWith(Compiler::files[i], ".o") || endsWith(Compiler::files[i], ".lib"))
+        if(endsWith(Compiler::files[i], ".a") || endsWith(Compiler::files[i], ".o") || endsWith(Compiler::files[i], ".lib")) {
             Compiler::linkString += Compiler::files[i] + " ";
+            objects.push_back(Compiler::files[i]);
+        }
         else {
             std::string outObj = "";
             std::string outLLVM = "";
@@ -539,22 +874,24 @@ void Compiler::compileAll() {
                     outLLVM = Compiler::outFile;
                 else outLLVM = (Compiler::files[i]+".ll");
             }
-            if(settings.emitObjCode || !settings.emitLLVM) {
+            if((settings.emitObjCode || !settings.emitLLVM) && !settings.linkModules) {
                 if(files.size() == 1 && settings.emitObjCode && Compiler::outFile.size())
                     outObj = Compiler::outFile;
                 else if(settings.saveObjectFiles) {
                     outObj = std::regex_replace(files[i], std::regex("\\.rave"), ".o");
                 } else {
-                    // TODO: store object files completely in RAM
                     outObj = std::string(".__rvobj_") + std::regex_replace(files[i], std::regex("\\.rave"), ".o");
                     toRemove.push_back(outObj);
                 }
                 Compiler::linkString += outObj + " ";
             }
-            compile(files[i], outObj, outLLVM);
+            jobs.push_back(Job(files[i], outObj, outLLVM));
         }
     }
 
+    compileJobs(jobs);
+    for(size_t i=0; i<jobs.size(); i++) if(jobs[i].bitcode.size()) modules.push_back(std::move(jobs[i].bitcode));
+
     for(size_t i=0; i<AST::addToImport.size(); i++) {
         std::string fname = replaceAll(AST::addToImport[i], ">", "");
         if(std::count(Compiler::toImport.begin(), Compiler::toImport.end(), fname) == 0 &&
@@ -562,35 +899,71 @@ void Compiler::compileAll() {
         ) Compiler::toImport.push_back(fname);
     }
 
-    for(size_t i=0; i<Compiler::toImport.size(); i++) {
-        if(access(Compiler::toImport[i].c_str(), 0) != 0) {
-            Compiler::error("file '" + Compiler::files[i] + "' does not exists!");
-            return;
-        }
-        if(Compiler::toImport[i].size() > 2 && (endsWith(Compiler::toImport[i], ".a") || endsWith(Compiler::toImport[i], ".o") || endsWith(Compiler::toImport[i], ".lib")))
-            Compiler::linkString += Compiler::toImport[i] + " ";
-        else {
-            #ifndef _WIN32
-            #  define fileExists(path) (access(path, 0) != -1)
-            #else
-            #  define fileExists(path) (GetFileAttributesA(path) != INVALID_FILE_ATTRIBUTES)
-            #endif
-            std::string compiledFile = std::regex_replace(Compiler::toImport[i], std::regex("\\.rave"), std::string(".") + Compiler::outType+".o");
-            if(
-                Compiler::toImport[i].find(exePath + "std/") != std::string::npos && !Compiler::settings.recompileStd &&
-                fileExists(compiledFile.c_str())
-            ) linkString += compiledFile + " ";
-            #undef fileExists
+    // Imported files can import other files, so they are compiled in waves until nothing new appears
+    for(size_t i=0; i<Compiler::toImport.size();) {
+        jobs.clear();
+
+        for(size_t end=Compiler::toImport.size(); i<end; i++) {
+            if(access(Compiler::toImport[i].c_str(), 0) != 0) {
+                Compiler::error("file '" + Compiler::toImport[i] + "' does not exists!");
+                return 1;
+            }
+            if(Compiler::toImport[i].size() > 2 && (endsWith(Compiler::toImport[i], ".a") || endsWith(Compiler::toImport[i], ".o") || endsWith(Compiler::toImport[i], ".lib"))) {
+                Compiler::linkString += Compiler::toImport[i] + " ";
+                objects.push_back(Compiler::toImport[i]);
+            }
             else {
-                compile(Compiler::toImport[i]);
-                if(Compiler::settings.emitLLVM) {
-                    char* err;
-                    LLVMPrintModuleToFile(generator->lModule, (Compiler::toImport[i] + ".ll").c_str(), &err);
+                #ifndef _WIN32
+                #  define fileExists(path) (access(path, 0) != -1)
+                #else
+                #  define fileExists(path) (GetFileAttributesA(path) != INVALID_FILE_ATTRIBUTES)
+                #endif
+                std::string compiledFile = std::regex_replace(Compiler::toImport[i], std::regex("\\.rave"), std::string(".") + Compiler::outType+".o");
+                bool isStd = Compiler::toImport[i].find(exePath + "std/") != std::string::npos;
+
+                // The precompiled std has no profile, so with PGO its modules are compiled into temporary objects (and reused through the object cache)
+                bool withProfile = Compiler::settings.profileGenerate || Compiler::settings.profileUse != "";
+                if(isStd && withProfile) compiledFile = ".__rvobj_" + fs::path(compiledFile).filename().string();
+
+                if(
+                    isStd && !withProfile && !Compiler::settings.recompileStd && !Compiler::settings.lto &&
+                    fileExists(compiledFile.c_str())
+                ) {
+                    // Under --run the precompiled std is loaded by the JIT as is, so only the program itself is compiled
+                    linkString += compiledFile + " ";
+                    objects.push_back(compiledFile);
+                }
+                #undef fileExists
+                else if(Compiler::settings.linkModules) jobs.push_back(Job(Compiler::toImport[i], "", Compiler::settings.emitLLVM ? (Compiler::toImport[i] + ".ll") : ""));
+                else {
+                    jobs.push_back(Job(Compiler::toImport[i], compiledFile, Compiler::settings.emitLLVM ? (Compiler::toImport[i] + ".ll") : ""));
+                    linkString += compiledFile + " ";
+                    if(!Compiler::settings.saveObjectFiles && (!isStd || withProfile)) toRemove.push_back(compiledFile);
                 }
-                linkString += compiledFile + " ";
-                if(!Compiler::settings.saveObjectFiles && Compiler::toImport[i].find(exePath + "std/") == std::string::npos) toRemove.push_back(compiledFile);
             }
         }
+
+        compileJobs(jobs);
+        for(size_t j=0; j<jobs.size(); j++) if(jobs[j].bitcode.size()) modules.push_back(std::move(jobs[j].bitcode));
+    }
+
+    if(Compiler::settings.run) {
+        for(size_t i=0; i<toRemove.size(); i++) std::remove(toRemove[i].c_str());
+        return JIT::run(modules, objects, Compiler::settings.runArguments);
+    }
+
+    if(Compiler::settings.linkModules && (settings.emitObjCode || !settings.emitLLVM) && modules.size()) {
+        // All modules were linked in memory, so only one object file is passed to the linker
+        std::string outObj;
+        if(files.size() == 1 && settings.emitObjCode && Compiler::outFile.size()) outObj = Compiler::outFile;
+        else if(settings.saveObjectFiles) outObj = (Compiler::outFile.size() ? Compiler::outFile : "a") + ".o";
+        else {
+            outObj = ".__rvobj_linked.o";
+            toRemove.push_back(outObj);
+        }
+
+        linkModules(modules, outObj);
+        Compiler::linkString += outObj + " ";
     }
 
     if(Compiler::outFile == "") Compiler::outFile = "a";
@@ -607,15 +980,26 @@ void Compiler::compileAll() {
 
     if(Compiler::settings.emitLLVM || (Compiler::settings.emitObjCode && Compiler::files.size() == 1));
     else {
+        if(Compiler::settings.profileGenerate && !Compiler::settings.emitObjCode) {
+            // The instrumented program needs the profile runtime of compiler-rt
+            if(Compiler::options["compiler"].template get<std::string>().find("clang") == std::string::npos) {
+                Compiler::error("--profile-generate requires clang as the linker!");
+                std::exit(1);
+            }
+            Compiler::linkString += "-fprofile-instr-generate ";
+        }
+
+        TimeTrace::Scope scope("Link", Compiler::outFile);
         ShellResult result = exec(Compiler::linkString + " -o " + Compiler::outFile);
         if(result.status != 0) {
             Compiler::error("error when linking!\nLinking string: '" + Compiler::linkString+" -o " + Compiler::outFile + "'");
             std::exit(result.status);
-            return;
+            return result.status;
         }
     }
 
     for(size_t i=0; i<toRemove.size(); i++) std::remove(toRemove[i].c_str());
 
     std::cout << "Time spent by lexer: " << std::to_string(Compiler::lexTime) << "ms\nTime spent by parser: " << std::to_string(Compiler::parseTime) << "ms\nTime spent by generator: " << std::to_string(Compiler::genTime) << "ms" << std::endl;
+    return 0;
 }
@@ -0,0 +1,38 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <cstddef>
+
+/*
+Bump allocator for tokens, nodes and types of the current compilation.
+Objects allocated while the arena is active are released together by Arena::reset (see Compiler::clearAll),
+their destructors are not called. Outside of a compilation the objects are allocated with malloc.
+The objects that outlive the compilation (the parsed imports and the interned types) are allocated under Arena::Persistent,
+they are kept until the thread ends.
+*/
+namespace Arena {
+    extern void* allocate(size_t size);
+    extern void deallocate(void* ptr);
+    extern void begin();
+    extern void reset();
+    extern bool isActive();
+
+    // While it exists, the arena allocates from the pool of the thread, that is not released by reset
+    struct Persistent {
+        void* previous;
+
+        Persistent();
+        ~Persistent();
+    };
+}
+
+// Base class of the objects that are placed in the arena.
+struct ArenaObject {
+    static void* operator new(size_t size) {return Arena::allocate(size);}
+    static void operator delete(void* ptr) {Arena::deallocate(ptr);}
+};
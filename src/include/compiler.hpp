@@ -8,6 +8,9 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "./utils.hpp"
 #include "./json.hpp"
+#include <sstream>
+#include <set>
+#include <ostream>
 
 namespace Compiler {
     extern std::string linkString;
@@ -17,14 +20,45 @@ namespace Compiler {
     extern std::string raveOs;
     extern genSettings settings;
     extern nlohmann::json options;
-    extern double lexTime;
-    extern double parseTime;
-    extern double genTime;
+    extern thread_local double lexTime;
+    extern thread_local double parseTime;
+    extern thread_local double genTime;
     extern std::vector<std::string> files;
     extern std::vector<std::string> toImport;
     extern bool debugMode;
     extern std::string features;
 
+    // Link names of the template instances, whose bodies were emitted by the finished jobs (only with -flto)
+    extern std::set<std::string> emittedTemplates;
+
+    // A single translation unit that is compiled by Compiler::compileJobs
+    struct Job {
+        std::string file;
+        std::string outputObj;
+        std::string outputLLVM;
+        std::vector<std::string> imported;
+        std::vector<std::string> addToImport;
+        std::string linkString;
+        std::string bitcode;
+        std::vector<std::string> templates;
+        std::ostringstream log;
+        int status = 0;
+        // Set if a path of the job was resolved against the directory of the main file (@compileAndLink with a relative path)
+        bool usesMainDirectory = false;
+
+        Job(std::string file, std::string outputObj = "", std::string outputLLVM = "") : file(file), outputObj(outputObj), outputLLVM(outputLLVM) {}
+        Job(Job&& other) : file(other.file), outputObj(other.outputObj), outputLLVM(other.outputLLVM), imported(other.imported),
+            addToImport(other.addToImport), linkString(other.linkString), bitcode(std::move(other.bitcode)), templates(std::move(other.templates)), log(std::move(other.log)), status(other.status), usesMainDirectory(other.usesMainDirectory) {}
+    };
+
+    // Thrown instead of std::exit inside of a worker thread
+    struct JobFailure {int status;};
+
+    extern thread_local Job* currentJob;
+
+    extern std::ostream& log();
+    [[noreturn]] extern void exit(int status);
+
     extern void loadPlatformVars();
     extern void setASTVariables();
 
@@ -33,5 +67,8 @@ namespace Compiler {
     extern void clearAll();
     extern void compile(std::string const& file, std::string const& outputObj = "", std::string const& outputLLVM = "");
 
-    extern void compileAll();
+    extern void compileJobs(std::vector<Job>& jobs);
+    extern void linkModules(std::vector<std::string> const& modules, std::string const& outputObj);
+    // Returns the exit status of the program under --run, otherwise 0
+    extern int compileAll();
 }
\ No newline at end of file
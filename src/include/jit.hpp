@@ -0,0 +1,19 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+/*
+In-process execution for --run, built on the LLLazyJIT of ORC.
+The modules are added as bitcode and every function is compiled on its first call; the object files and static libraries are linked by the JIT, the other symbols are taken from the loaded libraries.
+*/
+namespace JIT {
+    // Runs 'main' of the program with the given arguments and returns its exit status
+    extern int run(std::vector<std::string> const& modules, std::vector<std::string> const& objects, std::vector<std::string> const& arguments);
+}
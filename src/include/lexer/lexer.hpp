@@ -14,18 +14,26 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class Lexer {
 public:
-    std::string text = "";
+    // The lexer does not copy the source: the text is only viewed, and the position after its end reads as a space.
+    std::string source;
+    const char* text = nullptr;
+    size_t length = 0;
     std::vector<Token*> tokens;
     int32_t idx = 0;
     int32_t line = 0;
 
-    inline char peek() {return text[idx];}
-    inline char next() {idx += 1; return text[idx];}
+    inline char at(size_t i) {return (i + 1 < length) ? text[i] : ((i + 1 == length) ? ' ' : '\0');}
+    inline char peek() {return at(idx);}
+    inline char next() {idx += 1; return at(idx);}
     std::string replaceAllEscapes(std::string buffer, bool isChar = true);
+    void skipWord();
+    void skipSpaces();
     std::string getIdentifier();
     std::string getString();
     std::string getChar();
     std::string getDigit(char numType);
+    void lex();
     Lexer(std::string text, int offset);
+    Lexer(const char* text, size_t size, int offset);
     ~Lexer() {for(int i=0; i<this->tokens.size(); i++) delete this->tokens[i];}
 };
\ No newline at end of file
@@ -0,0 +1,27 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <string>
+
+// Read-only view of a source file. The file is memory-mapped where it is possible, otherwise read at once.
+class SourceFile {
+public:
+    const char* data = "";
+    size_t size = 0;
+    bool isOpen = false;
+
+    SourceFile(std::string const& path);
+    ~SourceFile();
+
+    SourceFile(SourceFile const&) = delete;
+    SourceFile& operator=(SourceFile const&) = delete;
+
+private:
+    bool isMapped = false;
+    std::string buffer;
+};
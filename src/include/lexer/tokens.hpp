@@ -7,6 +7,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #pragma once
 
 #include <string>
+#include <utility>
+#include "../arena.hpp"
 
 namespace TokType {
 enum TokType : char {
@@ -77,7 +79,7 @@ extern bool isCompoundAssigment(char type);
 extern bool isParent(char type);
 }
 
-class Token {
+class Token : public ArenaObject {
 public:
     char type;
     std::string value;
@@ -85,7 +87,7 @@ public:
 
     Token(char type, std::string value) {
         this->type = type;
-        this->value = value;
+        this->value = std::move(value);
     }
 
     Token(char type) {
@@ -95,7 +97,7 @@ public:
 
     Token(char type, std::string value, int line) {
         this->type = type;
-        this->value = value;
+        this->value = std::move(value);
         this->line = line;
     }
 
@@ -9,6 +9,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include <vector>
 #include <string>
 #include <llvm-c/Core.h>
+#include <llvm-c/Error.h>
+#include <llvm-c/TargetMachine.h>
 
 class Type;
 
@@ -54,6 +56,17 @@ namespace LLVM {
     extern RaveValue div(RaveValue first, RaveValue second, bool isUnsigned = false);
     extern RaveValue compare(RaveValue first, RaveValue second, char op);
 
+    // Function multiversioning of (target_clones: [...]): a variant for each target, selected at load time through an ifunc
+    extern bool isCloneTarget(std::string const& target);
+    extern void makeTargetClones(LLVMValueRef function, std::vector<std::string> const& targets);
+
+    // Runs the pipeline of the new pass manager; returns the error of a wrong pipeline, like LLVMRunPasses
+    extern LLVMErrorRef runPasses(LLVMModuleRef module, std::string const& passes, LLVMTargetMachineRef machine, bool loopVectorization, bool slpVectorization, bool loopUnrolling);
+
+    // Adds the functions to llvm.compiler.used, so the passes cannot remove them, and takes them back
+    extern void pinFunctions(LLVMModuleRef module, std::vector<std::string> const& names);
+    extern void unpinFunctions(LLVMModuleRef module, std::vector<std::string> const& names);
+
     namespace Builder {
         extern void atEnd(LLVMBasicBlockRef block);
     }
@@ -0,0 +1,135 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+// FNV-1a hash of the symbol names.
+struct SymbolHash {
+    static uint64_t hash(std::string const& key, uint64_t h = 14695981039346656037ULL) {
+        for(size_t i=0; i<key.size(); i++) {
+            h ^= (unsigned char)key[i];
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+
+    uint64_t operator()(std::string const& key) const {return hash(key);}
+    uint64_t operator()(std::pair<std::string, std::string> const& key) const {return hash(key.second, hash(key.first) ^ 0xFF);}
+};
+
+// Open-addressing hash table with the interface of std::map that is used by the compiler.
+// Elements are allocated separately, so the pointers, references and iterators stay valid when the table grows.
+// Iteration goes in the order of insertion.
+template<typename K, typename V, typename Hash = SymbolHash>
+class SymbolTable {
+public:
+    typedef std::pair<const K, V> value_type;
+
+    template<typename Table, typename Value>
+    struct basic_iterator {
+        Table* table;
+        size_t index;
+
+        Value& operator*() const {return *table->entries[index];}
+        Value* operator->() const {return table->entries[index];}
+        basic_iterator& operator++() {index = (index + 1 < table->entries.size()) ? index + 1 : npos; return *this;}
+        bool operator==(basic_iterator const& other) const {return index == other.index;}
+        bool operator!=(basic_iterator const& other) const {return index != other.index;}
+    };
+
+    typedef basic_iterator<SymbolTable, value_type> iterator;
+    typedef basic_iterator<const SymbolTable, const value_type> const_iterator;
+
+    SymbolTable() {}
+    SymbolTable(SymbolTable const& other) {*this = other;}
+    ~SymbolTable() {clear();}
+
+    SymbolTable& operator=(SymbolTable const& other) {
+        if(this == &other) return *this;
+        clear();
+        for(size_t i=0; i<other.entries.size(); i++) insert(*other.entries[i]);
+        return *this;
+    }
+
+    iterator begin() {return iterator{this, entries.empty() ? npos : 0};}
+    iterator end() {return iterator{this, npos};}
+    const_iterator begin() const {return const_iterator{this, entries.empty() ? npos : 0};}
+    const_iterator end() const {return const_iterator{this, npos};}
+
+    size_t size() const {return entries.size();}
+    bool empty() const {return entries.empty();}
+
+    void clear() {
+        for(size_t i=0; i<entries.size(); i++) delete entries[i];
+        entries.clear();
+        hashes.clear();
+        slots.clear();
+    }
+
+    iterator find(K const& key) {return iterator{this, lookup(key, Hash()(key))};}
+    const_iterator find(K const& key) const {return const_iterator{this, lookup(key, Hash()(key))};}
+    size_t count(K const& key) const {return lookup(key, Hash()(key)) != npos;}
+
+    std::pair<iterator, bool> insert(value_type const& value) {
+        uint64_t h = Hash()(value.first);
+        size_t index = lookup(value.first, h);
+        if(index != npos) return {iterator{this, index}, false};
+        return {iterator{this, add(value, h)}, true};
+    }
+
+    V& operator[](K const& key) {
+        uint64_t h = Hash()(key);
+        size_t index = lookup(key, h);
+        if(index == npos) index = add(value_type(key, V()), h);
+        return entries[index]->second;
+    }
+
+private:
+    static const size_t npos = (size_t)-1;
+
+    std::vector<value_type*> entries;
+    std::vector<uint64_t> hashes;
+    // Index of the entry plus one, zero means an empty slot
+    std::vector<uint32_t> slots;
+
+    size_t lookup(K const& key, uint64_t h) const {
+        if(slots.empty()) return npos;
+
+        size_t mask = slots.size() - 1;
+        for(size_t i=h & mask; slots[i] != 0; i=(i + 1) & mask) {
+            size_t index = slots[i] - 1;
+            if(hashes[index] == h && entries[index]->first == key) return index;
+        }
+        return npos;
+    }
+
+    void place(size_t index) {
+        size_t mask = slots.size() - 1;
+        size_t i = hashes[index] & mask;
+        while(slots[i] != 0) i = (i + 1) & mask;
+        slots[i] = index + 1;
+    }
+
+    size_t add(value_type const& value, uint64_t h) {
+        entries.push_back(new value_type(value));
+        hashes.push_back(h);
+
+        // Keep the load factor under 3/4
+        if(entries.size() * 4 > slots.size() * 3) {
+            slots.assign(slots.empty() ? 16 : slots.size() * 2, 0);
+            for(size_t i=0; i<entries.size(); i++) place(i);
+        }
+        else place(entries.size() - 1);
+
+        return entries.size() - 1;
+    }
+};
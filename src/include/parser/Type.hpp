@@ -7,9 +7,24 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #pragma once
 
 #include <string>
+#include <llvm-c/Core.h>
+#include "../arena.hpp"
 
-class Type {
+// Tag of the type class, so instanceof and the dispatch over the types are a compare instead of dynamic_cast
+enum class TypeKind : char {
+    Unknown,
+    Basic, Pointer, Array, Alias, Void, Const, Struct, Byval, TemplateMember, TemplateMemberDefinition,
+    FuncArg, Func, Builtin, Call, Auto, LLVM, Vector, Divided
+};
+
+class Type : public ArenaObject {
 public:
+    TypeKind kind = TypeKind::Unknown;
+
+    // The LLVM type generated for this type in the context, set only for the types that can not change (see isCanonicalType)
+    LLVMTypeRef llvmType = nullptr;
+    LLVMContextRef llvmContext = nullptr;
+
     virtual int getSize() = 0;
     virtual Type* check(Type* parent) = 0;
     virtual std::string toString() = 0;
@@ -38,6 +38,8 @@ namespace BasicType {
 
 class TypeBasic : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Basic;
+
     char type;
 
     TypeBasic(char ty);
@@ -54,7 +56,10 @@ extern std::map<char, TypeBasic*> basicTypes;
 
 class TypePointer : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Pointer;
+
     Type* instance;
+    std::string mangled; // Set only for the interned types
 
     TypePointer(Type* instance);
     Type* check(Type* parent) override;
@@ -67,8 +72,11 @@ public:
 
 class TypeArray : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Array;
+
     Node* count;
     Type* element;
+    std::string mangled; // Set only for the interned types
 
     TypeArray(Node* count, Type* element);
     Type* check(Type* parent) override;
@@ -81,6 +89,8 @@ public:
 
 class TypeAlias : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Alias;
+
     TypeAlias();
     Type* copy() override;
     Type* check(Type* parent) override;
@@ -91,6 +101,8 @@ public:
 
 class TypeVoid : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Void;
+
     TypeVoid();
     Type* copy() override;
     Type* check(Type* parent) override;
@@ -101,6 +113,8 @@ public:
 
 class TypeConst : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Const;
+
     Type* instance;
 
     TypeConst(Type* instance);
@@ -114,6 +128,8 @@ public:
 
 class TypeStruct : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Struct;
+
     std::string name;
     std::vector<Type*> types;
     
@@ -131,6 +147,8 @@ public:
 
 class TypeByval : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Byval;
+
     Type* type;
     TypeByval(Type* type);
     Type* copy() override;
@@ -142,6 +160,8 @@ public:
 
 class TypeTemplateMember : public Type {
 public:
+    static const TypeKind Kind = TypeKind::TemplateMember;
+
     Type* type;
     Node* value;
 
@@ -156,6 +176,8 @@ public:
 
 class TypeTemplateMemberDefinition : public Type {
 public:
+    static const TypeKind Kind = TypeKind::TemplateMemberDefinition;
+
     std::string name;
     Type* type;
 
@@ -170,6 +192,8 @@ public:
 
 class TypeFuncArg : public Type {
 public:
+    static const TypeKind Kind = TypeKind::FuncArg;
+
     Type* type;
     std::string name;
 
@@ -184,6 +208,8 @@ public:
 
 class TypeFunc : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Func;
+
     Type* main;
     std::vector<TypeFuncArg*> args;
     bool isVarArg;
@@ -199,6 +225,8 @@ public:
 
 class TypeBuiltin : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Builtin;
+
     std::string name;
     std::vector<Node*> args;
     NodeBlock* block;
@@ -213,6 +241,8 @@ public:
 
 class TypeCall : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Call;
+
     std::string name;
     std::vector<Node*> args;
 
@@ -226,6 +256,8 @@ public:
 
 class TypeAuto : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Auto;
+
     TypeAuto();
     Type* copy() override;
     Type* check(Type* parent) override;
@@ -236,6 +268,8 @@ public:
 
 class TypeLLVM : public Type {
 public:
+    static const TypeKind Kind = TypeKind::LLVM;
+
     LLVMTypeRef tr;
     TypeLLVM(LLVMTypeRef tr);
     Type* copy() override;
@@ -247,6 +281,8 @@ public:
 
 class TypeVector : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Vector;
+
     Type* mainType;
     int count;
 
@@ -260,6 +296,8 @@ public:
 
 class TypeDivided : public Type {
 public:
+    static const TypeKind Kind = TypeKind::Divided;
+
     Type* mainType;
     std::vector<Type*> divided;
 
@@ -275,4 +313,13 @@ extern Type* getType(std::string id);
 extern bool isFloatType(Type* type);
 extern bool isBytePointer(Type* type);
 
+// The closed types (the basic types, void and the pointers and arrays built only from them) are interned:
+// each of them exists once per compilation, so they are compared by the pointer and keep their string.
+// The other types can be rewritten in place by the alias and template substitution, so they are still compared by the string.
+extern bool isCanonicalType(Type* type);
+extern Type* getPointerType(Type* instance);
+extern Type* getArrayType(Node* count, Type* element);
+extern bool isSameType(Type* one, Type* two);
+extern void resetInternedTypes();
+
 extern TypeVoid* typeVoid;
\ No newline at end of file
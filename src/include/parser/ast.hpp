@@ -8,6 +8,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <string>
 #include <map>
+#include <set>
 #include <llvm-c/Core.h>
 
 #ifndef LLVM_VERSION
@@ -23,6 +24,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../utils.hpp"
 #include "./Type.hpp"
 #include "./Types.hpp"
+#include "./SymbolTable.hpp"
 #include "./nodes/Node.hpp"
 #include "../json.hpp"
 #include "../llvm.hpp"
@@ -47,27 +49,38 @@ struct FuncArgSet {
     std::vector<Type*> internalTypes;
 };
 
+// Every table below belongs to the translation unit that is being compiled right now.
+// They are thread-local, so each worker of the job pool (see Compiler::compileJobs) has its own copy.
 namespace AST {
-    extern std::map<std::string, Type*> aliasTypes;
-    extern std::map<std::string, Node*> aliasTable;
-    extern std::map<std::string, NodeVar*> varTable;
-    extern std::map<std::string, NodeFunc*> funcTable;
-    extern std::map<std::string, NodeStruct*> structTable;
-    extern std::map<std::string, NodeLambda*> lambdaTable;
-    extern std::map<std::pair<std::string, std::string>, NodeFunc*> methodTable;
-    extern std::map<std::pair<std::string, std::string>, StructMember> structsNumbers;
-    extern std::vector<std::string> importedFiles;
-    extern std::vector<std::string> addToImport;
-    extern std::map<std::string, std::vector<Node*>> parsed;
-    extern std::string mainFile;
+    extern thread_local SymbolTable<std::string, Type*> aliasTypes;
+    extern thread_local SymbolTable<std::string, Node*> aliasTable;
+    extern thread_local SymbolTable<std::string, NodeVar*> varTable;
+    extern thread_local SymbolTable<std::string, NodeFunc*> funcTable;
+    extern thread_local SymbolTable<std::string, NodeStruct*> structTable;
+    extern thread_local SymbolTable<std::string, NodeLambda*> lambdaTable;
+    extern thread_local SymbolTable<std::pair<std::string, std::string>, NodeFunc*> methodTable;
+    extern thread_local SymbolTable<std::string, std::set<std::string>> funcOverloads;
+    extern thread_local SymbolTable<std::pair<std::string, std::string>, std::set<std::string>> methodOverloads;
+    extern thread_local SymbolTable<std::pair<std::string, std::string>, StructMember> structsNumbers;
+    extern thread_local std::vector<std::string> importedFiles;
+    extern thread_local std::vector<std::string> addToImport;
+    extern thread_local std::map<std::string, std::vector<Node*>> parsed;
+    extern thread_local std::string mainFile;
     extern bool debugMode;
 
     void checkError(std::string message, int loc);
+
+    // Overload sets: the names of funcTable and methodTable that a call of the given name can resolve to, sorted by name
+    void addOverload(std::string const& name);
+    void addMethodOverload(std::string const& structName, std::string const& name);
+    std::set<std::string> const& getOverloads(std::string const& name);
+    std::set<std::string> const& getMethodOverloads(std::string const& structName, std::string const& name);
 }
 
 extern std::string typesToString(std::vector<FuncArgSet> args);
 extern std::string typesToString(std::vector<Type*> args);
 extern std::vector<Type*> parametersToTypes(std::vector<RaveValue> params);
+extern std::vector<Type*> getTrueTypeList(Type* t);
 
 class LLVMGen {
 public:
@@ -79,13 +92,14 @@ public:
     genSettings settings;
     nlohmann::json options;
     
-    std::map<std::string, RaveValue> globals;
-    std::map<std::string, RaveValue> functions;
-    std::map<std::string, LLVMTypeRef> structures;
+    SymbolTable<std::string, RaveValue> globals;
+    SymbolTable<std::string, RaveValue> functions;
+    SymbolTable<std::string, LLVMTypeRef> structures;
     std::map<int32_t, Loop> activeLoops;
 
     std::map<std::string, std::string> neededFunctions;
-    std::map<std::string, Type*> toReplace;
+    std::vector<std::pair<LLVMValueRef, std::vector<std::string>>> targetClones;
+    SymbolTable<std::string, Type*> toReplace;
     std::map<std::string, Node*> toReplaceValues;
 
     LLVMBasicBlockRef currBB;
@@ -110,17 +124,35 @@ public:
     int getAlignment(Type* type);
 };
 
+// Names of a function body: the arguments, the local variables and the local aliases, so an identifier is found by one probe.
+// Every change is logged, so the nested blocks are left by undoing the changes instead of copying the tables.
+class ScopeTable {
+public:
+    struct Entry {
+        RaveValue value = {nullptr, nullptr};
+        NodeVar* var = nullptr;
+        Node* alias = nullptr;
+        NodeVar* argVar = nullptr;
+        int arg = -1;
+    };
+
+    Entry* find(std::string const& name);
+    Entry& change(std::string const& name);
+    size_t mark() {return changes.size();}
+    void undo(size_t mark);
+
+private:
+    SymbolTable<std::string, Entry> entries;
+    std::vector<std::pair<Entry*, Entry>> changes;
+};
+
 class Scope {
 public:
-    std::map<std::string, RaveValue> localScope;
-    std::map<std::string, int> args;
+    ScopeTable names;
     std::string funcName;
-    LLVMBasicBlockRef blockExit;
+    LLVMBasicBlockRef blockExit = nullptr;
     bool funcHasRet = false;
-    std::map<std::string, NodeVar*> localVars;
-    std::map<std::string, NodeVar*> argVars;
-    std::map<std::string, Node*> aliasTable;
-    LLVMBasicBlockRef fnEnd;
+    LLVMBasicBlockRef fnEnd = nullptr;
     LLVMBasicBlockRef elseIfEnd = nullptr;
     bool detectMemoryLeaks = false;
 
@@ -130,17 +162,37 @@ public:
     RaveValue getWithoutLoad(std::string name, int loc = -1);
     NodeVar* getVar(std::string name, int loc = -1);
 
+    RaveValue getLocal(std::string const& name);
+    void setLocal(std::string const& name, RaveValue value);
+    void setVar(std::string const& name, NodeVar* var);
+    Node* getAlias(std::string const& name);
+    void setAlias(std::string const& name, Node* value);
+
     bool has(std::string name);
     bool hasAtThis(std::string name);
     bool locatedAtThis(std::string name);
     void hasChanged(std::string name);
+    void markUsed(std::string const& name);
     void remove(std::string name);
+
+    void push();
+    void pop();
+
+private:
+    struct Level {
+        size_t mark;
+        bool funcHasRet;
+        LLVMBasicBlockRef blockExit;
+        LLVMBasicBlockRef elseIfEnd;
+        bool detectMemoryLeaks;
+    };
+
+    std::vector<Level> levels;
 };
 
-extern LLVMGen* generator;
-extern Scope* currScope;
-extern LLVMTargetDataRef dataLayout;
+extern thread_local LLVMGen* generator;
+extern thread_local Scope* currScope;
+extern thread_local LLVMTargetDataRef dataLayout;
 
 extern TypeFunc* callToTFunc(NodeCall* call);
-extern Scope* copyScope(Scope* original);
 extern std::string typeToString(LLVMTypeRef type);
\ No newline at end of file
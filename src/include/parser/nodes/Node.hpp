@@ -9,14 +9,24 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include <llvm-c/Core.h>
 #include "../Type.hpp"
 #include "../../llvm.hpp"
+#include "../../arena.hpp"
 
 struct RetGenStmt {
     LLVMBasicBlockRef where;
     LLVMValueRef value;
 };
 
-class Node {
+// Tag of the node class, so instanceof and the dispatch over the nodes are a compare instead of dynamic_cast
+enum class NodeKind : char {
+    Unknown,
+    AliasType, Array, Asm, Binary, Block, Bool, Break, Builtin, Call, Cast, Char, Cmpxchg, Comptime, ConstStruct,
+    Continue, Defer, Done, Float, For, Foreach, Func, Get, Iden, If, Import, Imports, Index, Int, Itop, Lambda,
+    Namespace, None, Null, Ptoi, Ret, Sizeof, Slice, String, Struct, Switch, Type, Unary, Var, While
+};
+
+class Node : public ArenaObject {
 public:
+    NodeKind kind = NodeKind::Unknown;
     bool isChecked = false;
 
     virtual RaveValue generate();
@@ -14,6 +14,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeArray : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Array;
+
     int loc;
     std::vector<Node*> values;
     Type* type;
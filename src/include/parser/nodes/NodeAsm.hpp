@@ -14,6 +14,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeAsm : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Asm;
+
     std::string line;
     std::string additions = "";
     std::vector<Node*> values;
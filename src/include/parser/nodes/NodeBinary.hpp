@@ -20,6 +20,8 @@ namespace Binary {
 
 class NodeBinary : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Binary;
+
     char op;
     Node* first;
     Node* second;
@@ -13,6 +13,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeBlock : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Block;
+
     std::vector<Node*> nodes;
 
     NodeBlock(std::vector<Node*> nodes);
@@ -14,6 +14,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeBool : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Bool;
+
     bool value;
 
     NodeBool(bool value);
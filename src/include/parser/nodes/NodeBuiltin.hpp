@@ -19,6 +19,8 @@ class BigInt;
 
 class NodeBuiltin : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Builtin;
+
     std::string name;
     std::vector<Node*> args;
     int loc;
@@ -9,6 +9,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include <llvm-c/Core.h>
 #include "Node.hpp"
 #include "../Types.hpp"
+#include "../SymbolTable.hpp"
 
 class NodeFunc;
 
@@ -27,12 +28,14 @@ namespace Call {
     extern std::vector<Type*> getTypes(std::vector<Node*>& arguments);
     extern std::vector<RaveValue> genParameters(std::vector<Node*>& arguments, std::vector<int>& byVals, std::vector<FuncArgSet>& fas, CallSettings settings);
     extern std::vector<RaveValue> genParameters(std::vector<Node*>& arguments, std::vector<int>& byVals, NodeFunc* function, int loc);
-    extern std::map<std::pair<std::string, std::string>, NodeFunc *>::iterator findMethod(std::string structName, std::string methodName, std::vector<Node*>& arguments, int loc);
+    extern SymbolTable<std::pair<std::string, std::string>, NodeFunc*>::iterator findMethod(std::string structName, std::string methodName, std::vector<Node*>& arguments, int loc);
     extern RaveValue make(int loc, Node* function, std::vector<Node*> arguments);
 }
 
 class NodeCall : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Call;
+
     int loc;
     Node* func;
     std::vector<Node*> args;
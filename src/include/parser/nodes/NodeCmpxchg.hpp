@@ -14,6 +14,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeCmpxchg : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Cmpxchg;
+
     Node* ptr;
     Node* value1;
     Node* value2;
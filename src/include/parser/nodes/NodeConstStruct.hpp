@@ -16,6 +16,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeConstStruct : public Node {
 public:
+    static const NodeKind Kind = NodeKind::ConstStruct;
+
     std::string structName;
     std::vector<Node*> values;
     int loc;
@@ -20,6 +20,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeDefer : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Defer;
+
     Node* instruction;
     int loc;
     bool isFunctionScope;
@@ -15,6 +15,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeFloat : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Float;
+
     std::string value;
     TypeBasic* type = nullptr;
     bool isMustBeFloat = false;
@@ -14,6 +14,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeFor : public Node {
 public:
+    static const NodeKind Kind = NodeKind::For;
+
     std::vector<Node*> presets;
     Node* cond;
     std::vector<Node*> afters;
@@ -16,6 +16,8 @@ class NodeIden;
 
 class NodeForeach : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Foreach;
+
     NodeIden* elName;
     NodeBlock* block;
     Node* varData;
@@ -19,6 +19,8 @@ struct RetGenStmt;
 
 class NodeFunc : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Func;
+
     std::string name;
     std::string origName;
     std::string linkName;
@@ -32,6 +34,7 @@ public:
     NodeBlock* block;
 
     std::vector<DeclarMod> mods;
+    std::vector<std::string> targetClones;
 
     int loc;
     Type* type;
@@ -16,6 +16,8 @@ extern Type* getIdenType(std::string name, int loc);
 
 class NodeIden : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Iden;
+
     std::string name;
     int loc;
     bool isMustBePtr = false;
@@ -15,6 +15,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeIf : public Node {
 public:
+    static const NodeKind Kind = NodeKind::If;
+
     Node* cond = nullptr;
     Node* body = nullptr;
     Node* _else = nullptr;
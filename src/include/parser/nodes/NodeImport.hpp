@@ -21,6 +21,8 @@ typedef struct {
 
 class NodeImport : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Import;
+
     ImportFile file;
     std::vector<std::string> functions;
     int loc;
@@ -37,6 +39,8 @@ public:
 
 class NodeImports : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Imports;
+
     std::vector<NodeImport*> imports;
     int loc;
 
@@ -12,6 +12,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeIndex : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Index;
+
     Node* element;
     std::vector<Node*> indexes;
     int loc;
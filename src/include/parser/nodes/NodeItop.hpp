@@ -12,6 +12,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeItop : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Itop;
+
     Node* value;
     Type* type;
     int loc;
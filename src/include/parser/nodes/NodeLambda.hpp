@@ -18,6 +18,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeLambda : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Lambda;
+
     int loc;
     std::string name;
     LLVMValueRef f;
@@ -14,6 +14,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeNamespace : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Namespace;
+
     std::vector<std::string> names;
     std::vector<Node*> nodes;
     int loc;
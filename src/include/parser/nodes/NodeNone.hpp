@@ -3,4 +3,9 @@
 #include <llvm-c/Core.h>
 #include "Node.hpp"
 
-class NodeNone : public Node {};
+class NodeNone : public Node {
+public:
+    static const NodeKind Kind = NodeKind::None;
+
+    NodeNone() {this->kind = Kind;}
+};
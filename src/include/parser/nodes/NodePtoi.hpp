@@ -12,6 +12,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodePtoi : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Ptoi;
+
     Node* value;
     int loc;
 
@@ -12,6 +12,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeSizeof : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Sizeof;
+
     Node* value;
     int loc;
 
@@ -16,6 +16,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeSlice : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Slice;
+
     Node* base;
     Node* start;
     Node* end;
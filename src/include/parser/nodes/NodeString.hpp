@@ -14,6 +14,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeString : public Node {
 public:
+    static const NodeKind Kind = NodeKind::String;
+
     std::string value;
     bool isWide = false;
 
@@ -25,6 +25,8 @@ struct StructPredefined {
 
 class NodeStruct : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Struct;
+
     std::string name;
     std::vector<Node*> elements;
     std::map<std::string, StructPredefined> predefines;
@@ -15,6 +15,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeSwitch : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Switch;
+
     Node* expr = nullptr;
     Node* _default = nullptr;
     std::vector<std::pair<std::vector<Node*>, Node*>> statements;
@@ -24,6 +26,8 @@ public:
     Type* getType() override;
     void check() override;
     RaveValue generate() override;
+    bool isConstant();
+    void generateSwitch();
     Node* comptime() override;
     Node* copy() override;
     ~NodeSwitch() override;
@@ -16,6 +16,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeType : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Type;
+
     Type* type;
     int loc;
 
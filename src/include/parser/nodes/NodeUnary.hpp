@@ -15,6 +15,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeUnary : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Unary;
+
     int loc;
     char type;
     Node* base;
@@ -15,6 +15,8 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 class NodeVar : public Node {
 public:
+    static const NodeKind Kind = NodeKind::Var;
+
     std::string name;
     std::string origName;
     std::string linkName;
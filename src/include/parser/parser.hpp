@@ -16,7 +16,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "nodes/NodeBlock.hpp"
 #include "Types.hpp"
 
-extern std::map<char, int> operators;
+extern thread_local std::map<char, int> operators;
 
 struct DeclarMod {
     std::string name;
@@ -0,0 +1,37 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <string>
+
+namespace llvm {class PassInstrumentationCallbacks;}
+
+/*
+Compile-time profiler for --time-trace, built on the time profiler of LLVM.
+Every thread has its own profiler, so the spans of the parallel jobs do not mix; the spans of the code generation are added by LLVM itself.
+The result is written in the Chrome trace event format (chrome://tracing, Perfetto, speedscope).
+*/
+namespace TimeTrace {
+    extern bool enabled;
+    extern unsigned granularity;
+
+    extern void initializeThread();
+    extern void finishThread();
+    extern void write(std::string const& file);
+
+    // Adds a span for every pass of the new pass manager (LLVM 16+ does this itself in LLVMRunPasses)
+    extern void registerPassCallbacks(llvm::PassInstrumentationCallbacks& callbacks);
+
+    // Span from the construction to the destruction or to the call of end; does nothing if the profiler of the thread is not running
+    struct Scope {
+        bool active;
+
+        Scope(const char* name, std::string const& detail = "");
+        ~Scope() {end();}
+        void end();
+    };
+}
@@ -27,7 +27,7 @@ static std::string namespacesToString(std::vector<std::string> namespacesNames,
 static bool isBasicType(std::string s) {
     return s == "char" || s == "uchar" || s == "short" || s == "ushort" || s == "int" ||s == "uint" || s == "long" || s == "ulong"
     || s == "cent" || s == "ucent" || s == "void" || s == "float" || s == "double" || s == "real" || s == "half" || s == "bhalf"
-    || s == "float4" || s == "int4" || s == "int8" || s == "float8" || s == "short8";
+    || s == "float4" || s == "int4" || s == "int8" || s == "float8" || s == "short8" || s == "char16";
 }
 
 #ifdef _WIN32
@@ -84,11 +84,22 @@ static std::vector<std::string> filesInDirectory(std::string directory) {
 }
 #endif
 
+// The nodes and the types are checked by their kind tag, all other classes by dynamic_cast
 template<typename Base, typename T>
-static bool instanceof(const T* ptr) {
+static inline auto instanceofTagged(const T* ptr, int) -> decltype(ptr->kind == Base::Kind) {
+    return ptr != nullptr && ptr->kind == Base::Kind;
+}
+
+template<typename Base, typename T>
+static inline bool instanceofTagged(const T* ptr, long) {
     return dynamic_cast<const Base*>(ptr) != nullptr;
 }
 
+template<typename Base, typename T>
+static bool instanceof(const T* ptr) {
+    return instanceofTagged<Base>(ptr, 0);
+}
+
 #if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
     #define RAVE_OS "WINDOWS"
 #elif __linux__
@@ -121,6 +132,10 @@ typedef struct genSettings {
     bool noEntry = false;
     bool noStd = false;
     int optLevel = 1;
+    int sizeLevel = 0; // 1 - Os, 2 - Oz
+    std::string passes = ""; // Custom pipeline of the new pass manager, replaces the default one
+    bool profileGenerate = false;
+    std::string profileUse = ""; // Merged profile (.profdata) for the profile-guided optimization
     bool isPIE = false;
     bool isPIC = true;
     bool disableWarnings = false;
@@ -140,8 +155,16 @@ typedef struct genSettings {
     bool avx2 = true;
     bool avx512 = true;
     bool isNative = false;
+    std::string cpu = "generic"; // CPU of the target machine: its scheduling model and features
     bool noFastMath = false;
     bool noIoInit = false;
+    int jobs = 1;
+    bool noCache = false;
+    std::string cacheDir = ".rave-cache";
+    bool linkModules = false;
+    bool lto = false;
+    bool run = false; // Runs the program in the JIT instead of linking it
+    std::vector<std::string> runArguments; // Arguments of the program under --run (after its file)
 
     std::string linker = "lld";
 } genSettings;
@@ -0,0 +1,118 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "./include/jit.hpp"
+#include "./include/compiler.hpp"
+#include "./include/timetrace.hpp"
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/TargetProcess/TargetExecutionUtils.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Host.h>
+#include <sstream>
+
+static void check(llvm::Error error) {
+    if(error) {
+        Compiler::error("JIT: " + llvm::toString(std::move(error)));
+        std::exit(1);
+    }
+}
+
+template<typename T>
+static T unwrap(llvm::Expected<T> value) {
+    if(!value) check(value.takeError());
+    return std::move(*value);
+}
+
+// The same CPU and features, that were used for the generation of the modules
+static llvm::orc::JITTargetMachineBuilder targetMachine() {
+    llvm::orc::JITTargetMachineBuilder machine((llvm::Triple(llvm::sys::getProcessTriple())));
+    machine.setCPU(Compiler::settings.isNative ? llvm::sys::getHostCPUName().str() : Compiler::settings.cpu);
+
+    std::vector<std::string> features;
+    std::string feature;
+    for(size_t i=0; i<=Compiler::features.size(); i++) {
+        if(i == Compiler::features.size() || Compiler::features[i] == ',') {
+            if(feature != "") features.push_back(feature);
+            feature = "";
+        }
+        else feature += Compiler::features[i];
+    }
+    machine.addFeatures(features);
+
+    machine.setCodeGenOptLevel((Compiler::settings.optLevel > 0) ? llvm::CodeGenOpt::Default : llvm::CodeGenOpt::None);
+    return machine;
+}
+
+int JIT::run(std::vector<std::string> const& modules, std::vector<std::string> const& objects, std::vector<std::string> const& arguments) {
+    TimeTrace::Scope scope("JIT", Compiler::files[0]);
+
+    std::unique_ptr<llvm::orc::LLLazyJIT> jit = unwrap(llvm::orc::LLLazyJITBuilder().setJITTargetMachineBuilder(targetMachine()).create());
+    llvm::orc::JITDylib& library = jit->getMainJITDylib();
+    char prefix = jit->getDataLayout().getGlobalPrefix();
+
+    // Only the called functions are compiled, the rest of std is never touched
+    jit->setPartitionFunction(llvm::orc::CompileOnDemandLayer::compileRequested);
+
+    // libc and the libraries from --link and @link are resolved like the linker does it
+    library.addGenerator(unwrap(llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(prefix)));
+
+    std::istringstream params(Compiler::linkString + " " + Compiler::settings.linkParams);
+    std::string param;
+    while(params >> param) {
+        if(param.size() <= 2 || param.find("-l") != 0) continue;
+
+        #ifdef _WIN32
+            std::string name = param.substr(2) + ".dll";
+        #else
+            std::string name = "lib" + param.substr(2) + ".so";
+        #endif
+
+        // Some of them (libm.so, libpthread.so) are linker scripts, but their symbols are already in the process
+        llvm::Expected<std::unique_ptr<llvm::orc::DynamicLibrarySearchGenerator>> generator = llvm::orc::DynamicLibrarySearchGenerator::Load(name.c_str(), prefix);
+        if(generator) library.addGenerator(std::move(*generator));
+        else llvm::consumeError(generator.takeError());
+    }
+
+    for(size_t i=0; i<objects.size(); i++) {
+        if(endsWith(objects[i], ".a") || endsWith(objects[i], ".lib")) {
+            library.addGenerator(unwrap(llvm::orc::StaticLibraryDefinitionGenerator::Load(jit->getObjLinkingLayer(), objects[i].c_str())));
+            continue;
+        }
+
+        llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer = llvm::MemoryBuffer::getFile(objects[i]);
+        if(!buffer) {
+            Compiler::error("JIT: cannot read '" + objects[i] + "': " + buffer.getError().message());
+            std::exit(1);
+        }
+        check(jit->addObjectFile(std::move(*buffer)));
+    }
+
+    // All modules share one context, so the types of the same structures are not duplicated
+    llvm::orc::ThreadSafeContext context(std::make_unique<llvm::LLVMContext>());
+    for(size_t i=0; i<modules.size(); i++) {
+        std::unique_ptr<llvm::Module> module = unwrap(llvm::parseBitcodeFile(llvm::MemoryBufferRef(modules[i], "module"), *context.getContext()));
+        check(jit->addLazyIRModule(llvm::orc::ThreadSafeModule(std::move(module), context)));
+    }
+
+    typedef int (*MainFunction)(int, char**);
+
+    #if LLVM_VERSION >= 15
+        MainFunction main = unwrap(jit->lookup("main")).toPtr<MainFunction>();
+    #else
+        MainFunction main = (MainFunction)unwrap(jit->lookup("main")).getAddress();
+    #endif
+
+    scope.end();
+
+    // The global constructors and destructors run around 'main', as in the linked program
+    check(jit->initialize(library));
+    int status = llvm::orc::runAsMain(main, arguments, llvm::StringRef(Compiler::files[0]));
+    check(jit->deinitialize(library));
+
+    return status;
+}
@@ -12,7 +12,91 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include <vector>
 #include <stdint.h>
 #include <regex>
-#include <unordered_set>
+#include <cstring>
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Character classes of the lexer: a special character ends an identifier
+enum CharClass : unsigned char {
+    Special = 1,
+    Space = 2
+};
+
+static struct CharClasses {
+    unsigned char table[256] = {0};
+
+    CharClasses() {
+        const char specialChars[] = {
+            '+', '-', '*', '/', '>', '<', ',', '.', ';', '(', ')', '[', ']', '&',
+            '\'', '"', '~', '=', '{', '}', '!', ' ', '\n', '\r', ':', '@', '\0'
+        };
+        for(size_t i=0; i<sizeof(specialChars); i++) table[(unsigned char)specialChars[i]] |= CharClass::Special;
+
+        table[(unsigned char)' '] |= CharClass::Space;
+        table[(unsigned char)'\t'] |= CharClass::Space;
+        table[(unsigned char)'\r'] |= CharClass::Space;
+        table[(unsigned char)'\n'] |= CharClass::Space;
+    }
+
+    inline bool is(char c, CharClass cls) const {return table[(unsigned char)c] & cls;}
+} charClasses;
+
+#if defined(__SSE2__)
+// Mask of the bytes that are letters, digits or '_'
+static inline unsigned int wordMask(__m128i c) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i digit = _mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(c, _mm_set1_epi8('0')), _mm_set1_epi8(9)), zero);
+    __m128i upper = _mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(c, _mm_set1_epi8('A')), _mm_set1_epi8(25)), zero);
+    __m128i lower = _mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(c, _mm_set1_epi8('a')), _mm_set1_epi8(25)), zero);
+    __m128i underscore = _mm_cmpeq_epi8(c, _mm_set1_epi8('_'));
+    return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(digit, underscore), _mm_or_si128(upper, lower)));
+}
+#endif
+
+// Skips letters, digits and '_' (none of them is special) 16 bytes per step.
+inline void Lexer::skipWord() {
+    #if defined(__SSE2__)
+    while(idx + 16 < length) {
+        unsigned int mask = wordMask(_mm_loadu_si128((const __m128i*)(text + idx)));
+        if(mask != 0xFFFF) {
+            idx += __builtin_ctz(~mask);
+            return;
+        }
+        idx += 16;
+    }
+    #endif
+}
+
+// Skips spaces, tabs and line breaks, counting the lines.
+inline void Lexer::skipSpaces() {
+    #if defined(__SSE2__)
+    while(idx + 16 < length) {
+        __m128i c = _mm_loadu_si128((const __m128i*)(text + idx));
+        __m128i newLines = _mm_cmpeq_epi8(c, _mm_set1_epi8('\n'));
+        __m128i spaces = _mm_or_si128(_mm_or_si128(newLines, _mm_cmpeq_epi8(c, _mm_set1_epi8(' '))),
+                                      _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('\t')), _mm_cmpeq_epi8(c, _mm_set1_epi8('\r'))));
+        unsigned int mask = _mm_movemask_epi8(spaces);
+        unsigned int lines = _mm_movemask_epi8(newLines);
+
+        if(mask != 0xFFFF) {
+            int first = __builtin_ctz(~mask);
+            line += __builtin_popcount(lines & ((1u << first) - 1));
+            idx += first;
+            return;
+        }
+        line += __builtin_popcount(lines);
+        idx += 16;
+    }
+    #endif
+
+    while(charClasses.is(peek(), CharClass::Space)) {
+        if(peek() == '\n') line += 1;
+        idx += 1;
+    }
+}
 
 std::string Lexer::replaceAllEscapes(std::string buffer, bool isChar) {
     std::string str = replaceAll(replaceAll(replaceAll(replaceAll(replaceAll(buffer, "\\r", "\r"), "\\n", "\n"), "\\'", "\'"), "\\\"", "\""), "\\t", "\t");
@@ -20,29 +104,22 @@ std::string Lexer::replaceAllEscapes(std::string buffer, bool isChar) {
 }
 
 std::string Lexer::getIdentifier() {
-    static std::unordered_set<char> specialChars = {
-        '+', '-', '*', '/', '>', '<', ',', '.', ';', '(', ')', '[', ']', '&',
-        '\'', '"', '~', '=', '{', '}', '!', ' ', '\n', '\r', ':', '@'
-    };
-
-    std::string buffer = "";
+    int32_t start = idx;
 
-    while(specialChars.find(peek()) == specialChars.end()) {
-        buffer += peek();
+    while(!charClasses.is(peek(), CharClass::Special)) {
         idx += 1;
-        if(peek() == ':' && this->text[this->idx + 1] == ':') {
-            buffer += "::";
-            idx += 2;
-        }
+        skipWord();
+        if(peek() == ':' && at(this->idx + 1) == ':') idx += 2;
     }
 
-    return buffer;
+    // The identifier never reaches the space after the end of the text
+    return std::string(text + start, idx - start);
 }
 
 std::string Lexer::getString() {
     idx += 1;
     std::string buffer;
-    while(peek() != '"') {
+    while(peek() != '"' && idx < length) {
         if(peek() == '\\') {
             idx += 1;
             if(peek() == '"') buffer += "\"";
@@ -66,15 +143,15 @@ std::string Lexer::getString() {
 std::string Lexer::getChar() {
     idx += 1;
     std::string buffer = "", buffer2 = "";
-    while(peek() != '\'') {
-        if(peek() == '\\' && text[idx + 1] == '\'') {buffer += "'"; idx += 2;}
-        else if(peek() == '\\' && isdigit(text[idx + 1])) {
+    while(peek() != '\'' && idx < length) {
+        if(peek() == '\\' && at(idx + 1) == '\'') {buffer += "'"; idx += 2;}
+        else if(peek() == '\\' && isdigit(at(idx + 1))) {
             buffer2 += peek(); idx += 1;
             while(isdigit(peek())) {buffer2 += peek(); idx += 1;}
             buffer += replaceAllEscapes(buffer2);
             buffer2 = "";
         }
-        else if(peek() == '\\' && text[idx + 1] == '\\') {buffer += "\\"; idx += 2;}
+        else if(peek() == '\\' && at(idx + 1) == '\\') {buffer += "\\"; idx += 2;}
         else {buffer += peek(); idx += 1;}
     }
     next();
@@ -95,13 +172,23 @@ std::string Lexer::getDigit(char numType) {
 }
 
 Lexer::Lexer(std::string text, int offset) {
-    this->text = text + " ";
+    this->source = std::move(text);
+    this->text = this->source.data();
+    this->length = this->source.size() + 1;
     this->line = 0 - offset;
-    while(idx < this->text.size()) {
-        while(peek() == '\n' || peek() == '\r' || peek() == ' ' || peek() == '\t') {
-            if(peek() == '\n') line += 1;
-            idx += 1;
-        }
+    this->lex();
+}
+
+Lexer::Lexer(const char* text, size_t size, int offset) {
+    this->text = text;
+    this->length = size + 1;
+    this->line = 0 - offset;
+    this->lex();
+}
+
+void Lexer::lex() {
+    while(idx < this->length) {
+        skipSpaces();
         if(peek() == '\0' || peek() == 0 || peek() == EOF) break;
         switch(peek()) {
             case '+':
@@ -121,15 +208,20 @@ Lexer::Lexer(std::string text, int offset) {
             case '/':
                 next();
                 if(peek() == '=') {tokens.push_back(new Token(TokType::DivEqu, "/=", line)); idx += 1;}
-                else if(peek() == '/') {while(peek() != '\n') idx += 1;}
+                else if(peek() == '/') {
+                    const char* end = (const char*)std::memchr(text + idx, '\n', length - 1 - idx);
+                    idx = (end != nullptr) ? (end - text) : length;
+                }
                 else if(peek() == '*') {
                     idx += 1;
-                    while(peek() != '*' || this->text[this->idx+1] != '/') {
-                        if(peek() == '\n') line += 1;
-                        if(idx+1 >= text.size()) break;
-                        this->next();
-                    }
-                    this->idx += 2;
+                    const char* from = text + idx;
+                    const char* end = text + length - 1;
+                    const char* found = from;
+
+                    while((found = (const char*)std::memchr(found, '*', end - found)) != nullptr && (found + 1 >= end || found[1] != '/')) found += 1;
+
+                    line += std::count(from, (found != nullptr) ? found : end, '\n');
+                    idx = ((found != nullptr) ? (found - text) : (length - 1)) + 2;
                 }
                 else tokens.push_back(new Token(TokType::Divide, "/", line));
                 break;
@@ -158,7 +250,7 @@ Lexer::Lexer(std::string text, int offset) {
                 else tokens.push_back(new Token(TokType::Dot, ".", line));
                 break;
             case '~':
-                if((idx + 5) < this->text.size()) {
+                if((idx + 5) < length) {
                     int oldIdx = idx;
                     if(next() == 't' && next() == 'h' && next() == 'i' && next() == 's') {
                         if(next() != '.') {tokens.push_back(new Token(TokType::Identifier, "~this", line)); idx += 1;}
@@ -186,7 +278,7 @@ Lexer::Lexer(std::string text, int offset) {
             case '!':
                 if(next() == '=') {tokens.push_back(new Token(TokType::Nequal, "!=", line)); idx += 1;}
                 else if(peek() == '!') {tokens.push_back(new Token(TokType::BitXor, "!!", line)); idx += 1;}
-                else if(peek() == 'i' && text[idx + 1] == 'n' && (text[idx + 2] == ' ' || text[idx + 2] == '\n' || text[idx + 2] == '\t')) {
+                else if(peek() == 'i' && at(idx + 1) == 'n' && (at(idx + 2) == ' ' || at(idx + 2) == '\n' || at(idx + 2) == '\t')) {
                     idx += 3;
                     tokens.push_back(new Token(TokType::NeIn, "!in", line));
                 }
@@ -199,7 +291,7 @@ Lexer::Lexer(std::string text, int offset) {
                         bool isFloat = false;
                         std::string buffer = "";
                         idx -= 1;
-                        while(isdigit(this->peek()) || (this->peek() == '.' && this->text[this->idx + 1] != '.')) {
+                        while(isdigit(this->peek()) || (this->peek() == '.' && at(this->idx + 1) != '.')) {
                             if(this->peek() == '.') {
                                 isFloat = true;
                                 buffer += ".";
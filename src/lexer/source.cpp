@@ -0,0 +1,53 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "../include/lexer/source.hpp"
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+SourceFile::SourceFile(std::string const& path) {
+    #ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd >= 0) {
+        struct stat info;
+        if(fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+            this->isOpen = true;
+            if(info.st_size > 0) {
+                void* mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if(mapped != MAP_FAILED) {
+                    this->data = (const char*)mapped;
+                    this->size = info.st_size;
+                    this->isMapped = true;
+                }
+            }
+        }
+        close(fd);
+        if(this->isMapped || (this->isOpen && this->size == 0)) return;
+    }
+    #endif
+
+    // Fallback: read the whole file with a single buffer
+    std::ifstream fContent(path, std::ios::binary);
+    if(!fContent.is_open()) return;
+
+    this->buffer.assign((std::istreambuf_iterator<char>(fContent)), std::istreambuf_iterator<char>());
+    this->data = this->buffer.data();
+    this->size = this->buffer.size();
+    this->isOpen = true;
+}
+
+SourceFile::~SourceFile() {
+    #ifndef _WIN32
+    if(this->isMapped) munmap((void*)this->data, this->size);
+    #endif
+}
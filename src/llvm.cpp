@@ -11,14 +11,25 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "./include/parser/nodes/NodeStruct.hpp"
 #include "./include/parser/nodes/NodeVar.hpp"
 #include "./include/parser/nodes/NodeInt.hpp"
+#include "./include/compiler.hpp"
+#include "./include/timetrace.hpp"
 #include <iostream>
 #include <string>
+#include <algorithm>
 
 #include <llvm/Target/TargetMachine.h>
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/Analysis/TargetLibraryInfo.h>
 #include <llvm/Transforms/IPO.h>
 #include <llvm/IR/LegacyPassManager.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+#include <llvm/Transforms/Utils/ModuleUtils.h>
+#include <llvm-c/Transforms/PassBuilder.h>
+
+#if LLVM_VERSION < 16
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Passes/StandardInstrumentations.h>
+#endif
 
 // Wrapper for the LLVMBuildLoad2 function using RaveValue.
 RaveValue LLVM::load(RaveValue value, const char* name, int loc) {
@@ -33,7 +44,7 @@ bool LLVM::isLoad(LLVMValueRef operation) {
 void LLVM::undoLoad(RaveValue& value) {
     LLVMValueRef origArg = LLVMGetArgOperand(value.value, 0);
     value.value = origArg;
-    value.type = new TypePointer(value.type);
+    value.type = getPointerType(value.type);
 }
 
 // Wrapper for the LLVMBuildCall2 function using RaveValue.
@@ -93,7 +104,7 @@ RaveValue LLVM::cInboundsGep(RaveValue ptr, LLVMValueRef* indices, unsigned int
 
 // Wrapper for the LLVMBuildGEP2 function using RaveValue.
 RaveValue LLVM::gep(RaveValue ptr, LLVMValueRef* indices, unsigned int indicesCount, const char* name) {
-    return {LLVMBuildGEP2(generator->builder, generator->genType(ptr.type->getElType(), -1), ptr.value, indices, indicesCount, name), new TypePointer(ptr.type->getElType())};
+    return {LLVMBuildGEP2(generator->builder, generator->genType(ptr.type->getElType(), -1), ptr.value, indices, indicesCount, name), getPointerType(ptr.type->getElType())};
 }
 
 // Wrapper for the LLVMBuildStructGEP2 function using RaveValue.
@@ -103,7 +114,7 @@ RaveValue LLVM::structGep(RaveValue ptr, unsigned int idx, const char* name) {
     return {LLVMBuildStructGEP2(
         generator->builder, generator->genType(ts, -1),
         ptr.value, idx, name
-    ), new TypePointer(AST::structTable[ts->name]->getVariables()[idx]->getType())};
+    ), getPointerType(AST::structTable[ts->name]->getVariables()[idx]->getType())};
 }
 
 // Wrapper for the LLVMBuildAlloca function using RaveValue. Builds alloca at the first basic block for saving stack memory (C behaviour).
@@ -111,12 +122,12 @@ RaveValue LLVM::alloc(Type* type, const char* name) {
     LLVMPositionBuilder(generator->builder, LLVMGetFirstBasicBlock(generator->functions[currScope->funcName].value), LLVMGetFirstInstruction(LLVMGetFirstBasicBlock(generator->functions[currScope->funcName].value)));
     LLVMValueRef value = LLVMBuildAlloca(generator->builder, generator->genType(type, -1), name);
     LLVMPositionBuilderAtEnd(generator->builder, generator->currBB);
-    return {value, new TypePointer(type)};
+    return {value, getPointerType(type)};
 }
 
 // Wrapper for the LLVMBuildArrayAlloca function using RaveValue.
 RaveValue LLVM::alloc(RaveValue size, const char* name) {
-    return {LLVMBuildArrayAlloca(generator->builder, LLVMInt8TypeInContext(generator->context), size.value, name), new TypePointer(basicTypes[BasicType::Char])};
+    return {LLVMBuildArrayAlloca(generator->builder, LLVMInt8TypeInContext(generator->context), size.value, name), getPointerType(basicTypes[BasicType::Char])};
 }
 
 // Enables/disables fast math.
@@ -145,7 +156,7 @@ LLVMValueRef LLVM::makeInt(size_t n, unsigned long long value, bool isUnsigned)
 RaveValue LLVM::makeCArray(Type* ty, std::vector<RaveValue> values) {
     std::vector<LLVMValueRef> data;
     for(int i=0; i<values.size(); i++) data.push_back(values[i].value);
-    return {LLVMConstArray(generator->genType(ty, -1), data.data(), data.size()), new TypeArray(new NodeInt(data.size()), ty)};
+    return {LLVMConstArray(generator->genType(ty, -1), data.data(), data.size()), getArrayType(new NodeInt(data.size()), ty)};
 }
 
 // Wrappers for LLVMAppendBasicBlockInContext
@@ -297,4 +308,168 @@ RaveValue LLVM::compare(RaveValue first, RaveValue second, char op) {
 void LLVM::Builder::atEnd(LLVMBasicBlockRef block) {
     generator->currBB = block;
     LLVMPositionBuilderAtEnd(generator->builder, block);
-}
\ No newline at end of file
+}
+
+// Bits of __cpu_model.__cpu_features[0], filled by __cpu_indicator_init from libgcc or compiler-rt
+static const std::map<std::string, uint32_t> cpuFeatureBits = {
+    {"cmov", 0}, {"mmx", 1}, {"popcnt", 2}, {"sse", 3}, {"sse2", 4}, {"sse3", 5}, {"ssse3", 6}, {"sse4.1", 7}, {"sse4.2", 8},
+    {"avx", 9}, {"avx2", 10}, {"sse4a", 11}, {"fma4", 12}, {"xop", 13}, {"fma", 14}, {"avx512f", 15}, {"bmi", 16}, {"bmi2", 17},
+    {"aes", 18}, {"pclmul", 19}, {"avx512vl", 20}, {"avx512bw", 21}, {"avx512dq", 22}, {"avx512cd", 23}
+};
+
+// A target is 'default' or a list of features separated by commas ("avx2,fma")
+static bool cloneTargetMask(std::string const& target, uint32_t& mask) {
+    mask = 0;
+    size_t start = 0;
+
+    while(start <= target.size()) {
+        size_t end = target.find(',', start);
+        if(end == std::string::npos) end = target.size();
+
+        auto bit = cpuFeatureBits.find(target.substr(start, end - start));
+        if(bit == cpuFeatureBits.end()) return false;
+        mask |= (1u << bit->second);
+        start = end + 1;
+    }
+    return true;
+}
+
+bool LLVM::isCloneTarget(std::string const& target) {
+    uint32_t mask;
+    return target == "default" || cloneTargetMask(target, mask);
+}
+
+// Replaces the function with an ifunc of the same name; its resolver checks the targets in the given order and falls back to the default variant
+void LLVM::makeTargetClones(LLVMValueRef function, std::vector<std::string> const& targets) {
+    llvm::Function* origin = llvm::unwrap<llvm::Function>(function);
+    llvm::Module* module = origin->getParent();
+    llvm::LLVMContext& context = module->getContext();
+    std::string name = origin->getName().str();
+    origin->setName(name + ".origin");
+
+    std::vector<std::pair<uint32_t, llvm::Function*>> variants;
+    llvm::Function* byDefault = nullptr;
+
+    for(size_t i=0; i<targets.size() + 1; i++) {
+        std::string target = (i < targets.size()) ? targets[i] : "default";
+        if(target == "default" && byDefault != nullptr) continue;
+
+        llvm::ValueToValueMapTy map;
+        llvm::Function* clone = llvm::CloneFunction(origin, map);
+        std::string suffix = target;
+        std::replace(suffix.begin(), suffix.end(), ',', '_');
+        clone->setName(name + "." + suffix);
+        clone->setLinkage(llvm::GlobalValue::InternalLinkage);
+        clone->setComdat(nullptr);
+
+        if(target == "default") byDefault = clone;
+        else {
+            uint32_t mask;
+            cloneTargetMask(target, mask);
+
+            std::string features = Compiler::features;
+            for(auto& bit : cpuFeatureBits) if(mask & (1u << bit.second)) features += (features.empty() ? "+" : ",+") + bit.first;
+            clone->addFnAttr("target-features", features);
+            variants.push_back({mask, clone});
+        }
+    }
+
+    // The resolver runs before the constructors, so the CPU features are detected by it
+    llvm::Function* resolver = llvm::Function::Create(llvm::FunctionType::get(origin->getType(), false), llvm::GlobalValue::InternalLinkage, name + ".resolver", module);
+    llvm::IRBuilder<> builder(llvm::BasicBlock::Create(context, "entry", resolver));
+    builder.CreateCall(module->getOrInsertFunction("__cpu_indicator_init", llvm::FunctionType::get(builder.getVoidTy(), false)));
+
+    llvm::ArrayType* featuresType = llvm::ArrayType::get(builder.getInt32Ty(), 1);
+    llvm::StructType* modelType = llvm::StructType::get(context, {builder.getInt32Ty(), builder.getInt32Ty(), builder.getInt32Ty(), featuresType});
+    llvm::Value* model = module->getOrInsertGlobal("__cpu_model", modelType);
+    llvm::Value* features = builder.CreateConstInBoundsGEP2_32(featuresType, builder.CreateConstInBoundsGEP2_32(modelType, model, 0, 3), 0, 0);
+    features = builder.CreateLoad(builder.getInt32Ty(), features, "features");
+
+    for(auto& variant : variants) {
+        llvm::BasicBlock* selected = llvm::BasicBlock::Create(context, "selected", resolver);
+        llvm::BasicBlock* next = llvm::BasicBlock::Create(context, "next", resolver);
+        llvm::Value* mask = builder.getInt32(variant.first);
+
+        builder.CreateCondBr(builder.CreateICmpEQ(builder.CreateAnd(features, mask), mask), selected, next);
+        builder.SetInsertPoint(selected);
+        builder.CreateRet(variant.second);
+        builder.SetInsertPoint(next);
+    }
+    builder.CreateRet(byDefault);
+
+    llvm::GlobalIFunc* ifunc = llvm::GlobalIFunc::create(origin->getValueType(), 0, origin->getLinkage(), name, resolver, module);
+    origin->replaceAllUsesWith(ifunc);
+    origin->eraseFromParent();
+}
+
+void LLVM::pinFunctions(LLVMModuleRef module, std::vector<std::string> const& names) {
+    llvm::Module* unwrapped = llvm::unwrap(module);
+    std::vector<llvm::GlobalValue*> functions;
+
+    for(size_t i=0; i<names.size(); i++) {
+        llvm::Function* function = unwrapped->getFunction(names[i]);
+        if(function != nullptr && !function->isDeclaration()) functions.push_back(function);
+    }
+
+    if(!functions.empty()) llvm::appendToCompilerUsed(*unwrapped, functions);
+}
+
+// LLVM 14 has no function to remove the values from llvm.compiler.used, so the list is built again without them
+void LLVM::unpinFunctions(LLVMModuleRef module, std::vector<std::string> const& names) {
+    llvm::Module* unwrapped = llvm::unwrap(module);
+    llvm::GlobalVariable* used = unwrapped->getNamedGlobal("llvm.compiler.used");
+    if(used == nullptr || !used->hasInitializer()) return;
+
+    std::vector<llvm::GlobalValue*> kept;
+    if(llvm::ConstantArray* values = llvm::dyn_cast<llvm::ConstantArray>(used->getInitializer())) {
+        for(llvm::Use& value : values->operands()) {
+            llvm::GlobalValue* global = llvm::dyn_cast<llvm::GlobalValue>(value->stripPointerCasts());
+            if(global != nullptr && std::find(names.begin(), names.end(), global->getName().str()) == names.end()) kept.push_back(global);
+        }
+    }
+
+    used->eraseFromParent();
+    if(!kept.empty()) llvm::appendToCompilerUsed(*unwrapped, kept);
+}
+
+LLVMErrorRef LLVM::runPasses(LLVMModuleRef module, std::string const& passes, LLVMTargetMachineRef machine, bool loopVectorization, bool slpVectorization, bool loopUnrolling) {
+    #if LLVM_VERSION >= 16
+    LLVMPassBuilderOptionsRef options = LLVMCreatePassBuilderOptions();
+    LLVMPassBuilderOptionsSetLoopVectorization(options, loopVectorization);
+    LLVMPassBuilderOptionsSetSLPVectorization(options, slpVectorization);
+    LLVMPassBuilderOptionsSetLoopUnrolling(options, loopUnrolling);
+
+    LLVMErrorRef error = LLVMRunPasses(module, passes.c_str(), machine, options);
+    LLVMDisposePassBuilderOptions(options);
+    return error;
+    #else
+    // LLVMRunPasses of LLVM 14-15 does not accept the instrumentation callbacks, so it is repeated here with the spans of the time trace
+    llvm::PipelineTuningOptions tuning;
+    tuning.LoopVectorization = loopVectorization;
+    tuning.SLPVectorization = slpVectorization;
+    tuning.LoopUnrolling = loopUnrolling;
+
+    llvm::PassInstrumentationCallbacks callbacks;
+    llvm::PassBuilder builder(reinterpret_cast<llvm::TargetMachine*>(machine), tuning, llvm::None, &callbacks);
+
+    llvm::LoopAnalysisManager loopAnalyses;
+    llvm::FunctionAnalysisManager functionAnalyses;
+    llvm::CGSCCAnalysisManager cgsccAnalyses;
+    llvm::ModuleAnalysisManager moduleAnalyses;
+    builder.registerModuleAnalyses(moduleAnalyses);
+    builder.registerCGSCCAnalyses(cgsccAnalyses);
+    builder.registerFunctionAnalyses(functionAnalyses);
+    builder.registerLoopAnalyses(loopAnalyses);
+    builder.crossRegisterProxies(loopAnalyses, functionAnalyses, cgsccAnalyses, moduleAnalyses);
+
+    llvm::StandardInstrumentations instrumentations(false, false);
+    instrumentations.registerCallbacks(callbacks, &functionAnalyses);
+    TimeTrace::registerPassCallbacks(callbacks);
+
+    llvm::ModulePassManager manager;
+    if(llvm::Error error = builder.parsePassPipeline(manager, passes)) return llvm::wrap(std::move(error));
+
+    manager.run(*llvm::unwrap(module), moduleAnalyses);
+    return nullptr;
+    #endif
+}
@@ -10,6 +10,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "./include/lexer/lexer.hpp"
 #include "./include/parser/parser.hpp"
 #include "./include/compiler.hpp"
+#include "./include/timetrace.hpp"
 
 #define R128_IMPLEMENTATION
 #include "./include/r128.h"
@@ -21,11 +22,28 @@ genSettings options;
 std::string exePath;
 bool helpCalled = false;
 
+// The non-negative number after the option; a missing or wrong value is reported as an error
+static int numberArgument(std::vector<std::string>& arguments, int i) {
+    if(i + 1 < arguments.size()) {
+        try {
+            size_t end = 0;
+            int number = std::stoi(arguments[i + 1], &end);
+            if(end == arguments[i + 1].size() && number >= 0) return number;
+        }
+        catch(std::exception&) {}
+
+        Compiler::error("the option '" + arguments[i] + "' requires a number, but '" + arguments[i + 1] + "' was given!");
+    }
+    else Compiler::error("the option '" + arguments[i] + "' requires a number!");
+    return 0;
+}
+
 // Analyzing command-line arguments.
 genSettings analyzeArguments(std::vector<std::string>& arguments) {
     genSettings settings;
     for(int i=0; i<arguments.size(); i++) {
-        if(arguments[i] == "-o" || arguments[i] == "--out") {outFile = arguments[i + 1]; i += 1;} // Output file
+        if(settings.run && files.size() > 0) settings.runArguments.push_back(arguments[i]); // Arguments after the file belong to the program
+        else if(arguments[i] == "-o" || arguments[i] == "--out") {outFile = arguments[i + 1]; i += 1;} // Output file
         else if(arguments[i] == "-np" || arguments[i] == "--noPrelude") settings.noPrelude = true; // Disables importing of std/prelude
         else if(arguments[i] == "-eml" || arguments[i] == "--emitLLVM" || arguments[i] == "-emit-llvm") settings.emitLLVM = true; // Enables output of .ll files
         else if(arguments[i] == "-l" || arguments[i] == "--link") {settings.linkParams += "-l" + arguments[i + 1] + " "; i += 1;} // Adds library to the linker
@@ -38,6 +56,8 @@ genSettings analyzeArguments(std::vector<std::string>& arguments) {
         else if(arguments[i] == "-O1") settings.optLevel = 1; // Sets the optimization level to 1
         else if(arguments[i] == "-O2") settings.optLevel = 2; // Sets the optimization level to 2
         else if(arguments[i] == "-O3") settings.optLevel = 3; // Sets the optimization level to 3
+        else if(arguments[i] == "-Os") {settings.optLevel = 2; settings.sizeLevel = 1;} // Sets the optimization level to 2, optimizes for size
+        else if(arguments[i] == "-Oz") {settings.optLevel = 2; settings.sizeLevel = 2;} // Sets the optimization level to 2, optimizes for size aggressively
         else if(arguments[i] == "-Ofast") {settings.optLevel = 3; settings.noChecks = true;} // Sets the optimization level to 3, disables runtime checks (Ofast mode)
         else if(arguments[i].find("-O") == 0) settings.optLevel = 1; // Sets the optimization level to 1 as undefined
         else if(arguments[i] == "-s" || arguments[i] == "--shared") {settings.linkParams += "-shared "; settings.isPIE = true; settings.isPIC = false;} // Enables shared mode for linker
@@ -47,6 +67,10 @@ genSettings analyzeArguments(std::vector<std::string>& arguments) {
         else if(arguments[i] == "-t" || arguments[i] == "--target") {outType = arguments[i + 1]; i += 1;} // Sets the target platform type
         else if(arguments[i] == "-h" || arguments[i] == "--help") helpCalled = true; // Outputs all possible arguments
         else if(arguments[i] == "-native") settings.isNative = true; // Enables native mode (for better optimizations)
+        else if(arguments[i].find("-mcpu=") == 0 || arguments[i].find("-march=") == 0) { // Sets the target CPU
+            settings.cpu = arguments[i].substr(arguments[i].find('=') + 1);
+            if(settings.cpu == "native") settings.isNative = true;
+        }
         else if(arguments[i] == "-noSSE") settings.sse = false;
         else if(arguments[i] == "-noSSE2") settings.sse2 = false;
         else if(arguments[i] == "-noSSE3") settings.sse3 = false;
@@ -59,6 +83,17 @@ genSettings analyzeArguments(std::vector<std::string>& arguments) {
         else if(arguments[i] == "-noAVX512") settings.avx512 = false;
         else if(arguments[i] == "-nfm" || arguments[i] == "--noFastMath") settings.noFastMath = true; // Disables fast math
         else if(arguments[i] == "-nio" || arguments[i] == "--noIoInit") settings.noIoInit = true; // Disables io initialize (temporarily does nothing)
+        else if(arguments[i] == "-j" || arguments[i] == "--jobs") {settings.jobs = numberArgument(arguments, i); i += 1;} // Sets the number of files compiled in parallel
+        else if(arguments[i] == "-nca" || arguments[i] == "--noCache") settings.noCache = true; // Disables the object cache
+        else if(arguments[i] == "--cacheDir") {settings.cacheDir = arguments[i + 1]; i += 1;} // Sets the directory of the object cache
+        else if(arguments[i] == "-lm" || arguments[i] == "--linkModules") settings.linkModules = true; // Links all modules in memory into a single object file
+        else if(arguments[i] == "--passes") {settings.passes = arguments[i + 1]; i += 1;} // Sets the custom pipeline of the optimization passes
+        else if(arguments[i] == "--profile-generate" || arguments[i] == "-fprofile-generate") settings.profileGenerate = true; // Instruments the program to write the execution profile
+        else if(arguments[i] == "--profile-use" || arguments[i] == "-fprofile-use") {settings.profileUse = arguments[i + 1]; i += 1;} // Optimizes the program with the merged execution profile
+        else if(arguments[i] == "-flto") {settings.lto = true; settings.linkModules = true;} // Optimizes the whole program after linking all modules (including std)
+        else if(arguments[i] == "--run") {settings.run = true; settings.linkModules = true;} // Runs the program in the JIT instead of linking it
+        else if(arguments[i] == "--time-trace" || arguments[i] == "-ftime-trace") TimeTrace::enabled = true; // Writes the compile-time profile in the Chrome trace format
+        else if(arguments[i] == "--time-trace-granularity") {TimeTrace::granularity = numberArgument(arguments, i); i += 1;} // Sets the minimal duration of the spans in the time trace (in microseconds)
         else if(arguments[i][0] == '-') settings.linkParams += arguments[i] + " "; // Adds unknown argument to the linker
         else files.push_back(arguments[i]);
     }
@@ -82,6 +117,8 @@ int main(int argc, char** argv) {
         + "\n\t--emitLLVM, -emit-llvm (-eml) - Create output files with LLVM IR."
         + "\n\t--recompileStd (-rcs) - Recompile the standart library with flags and replacing the cache version (if available)."
         + "\n\t-O0, -O1, -O2, -O3, -Ofast - Optimization levels (in ascending order of output program speed)."
+        + "\n\t-Os, -Oz - Optimize for size (-Oz is more aggressive)."
+        + "\n\t--passes <pipeline> - Run the LLVM pass pipeline <pipeline> (for example, \"default<O2>,loop-unroll\") instead of the default one."
         + "\n\t--link (-l) <library> - Add the <library> library to the linker."
         + "\n\t--noStd (-ns) - Do not link with standart library."
         + "\n\t--noEntry (-ne) - Passes information to the compiler that there is no start point (main) in the code."
@@ -91,28 +128,44 @@ int main(int argc, char** argv) {
         + "\n\t--disableWarnings (-dw) - Disables warnings."
         + "\n\t--shared (-s) - Creates a shared output files."
         + "\n\t-native - Use optimizations from the current platform."
+        + "\n\t-mcpu=<cpu>, -march=<cpu> - Tune the code for <cpu> and use its features (native - the current CPU, like -native)."
         + "\n\t-noSSE, -noSSE, -noSSE2, -noSSE3, -noSSSE3, -noSSE4A, -noSSE4_1, -noSSE4_2 - Disable different SSE versions for compiler (if they are available)."
         + "\n\t-noAVX, -noAVX2, -noAVX512 - Disable different AVX versions for compiler (if it is available)."
         + "\n\t--noFastMath (-nfm) - Disable fast math."
         + "\n\t--noIoInit (-nio) - Disable the automatic std::io:initialize call at the beginning of 'main'."
+        + "\n\t--jobs (-j) <N> - Compile up to <N> files in parallel (0 - use all available cores)."
+        + "\n\t--noCache (-nca) - Do not reuse or store object files in the cache."
+        + "\n\t--cacheDir <dir> - Keep the object cache in <dir> (.rave-cache by default)."
+        + "\n\t--linkModules (-lm) - Link all compiled modules in memory and pass a single object file to the linker."
+        + "\n\t--profile-generate (-fprofile-generate) - Instrument the program, so it writes its execution profile into default.profraw (or LLVM_PROFILE_FILE) when it exits."
+        + "\n\t--profile-use (-fprofile-use) <file> - Optimize the program with the profile <file>, merged by 'llvm-profdata merge -o <file> *.profraw'."
+        + "\n\t-flto - Compile std from source and optimize the whole program after linking (implies --linkModules)."
+        + "\n\t--run <file> [args] - Compile the program in memory and run it in the JIT with [args], functions are compiled on the first call."
+        + "\n\t--time-trace (-ftime-trace) - Write the time spent on each file, import, function, template and LLVM pass into <out>.time-trace.json (Chrome trace format)."
+        + "\n\t--time-trace-granularity <N> - Drop the spans of the time trace shorter than <N> microseconds (50 by default)."
         + "\nFor bug reporting, you can use Issues at https://github.com/Ttimofeyka/Rave.";
         std::cout << help << std::endl;
         return 0;
     }
 
+    TimeTrace::initializeThread();
+
     if(files.size() == 0) {
         if(options.recompileStd) {
             Compiler::initialize(outFile, outType, options, {""});
             auto stdFiles = filesInDirectory(exePath + "std");
+            std::vector<Compiler::Job> jobs;
             for(size_t i=0; i<stdFiles.size(); i++) {
                 if(stdFiles[i].find(".ll") == std::string::npos && stdFiles[i].find(".rave") != std::string::npos) {
                     std::string fullpath = exePath + "std/" + stdFiles[i];
                     std::string compiledFile = std::regex_replace(fullpath, std::regex("\\.rave"), std::string(".") + Compiler::outType + ".o");
                     std::string llvmIR;
                     if(options.emitLLVM) llvmIR = exePath + "std/" + stdFiles[i] + ".ll";
-                    Compiler::compile(fullpath, compiledFile, llvmIR);
+                    jobs.push_back(Compiler::Job(fullpath, compiledFile, llvmIR));
                 }
             }
+            Compiler::compileJobs(jobs);
+            TimeTrace::write("std.time-trace.json");
             std::cout << "Time spent by lexer: " << std::to_string(Compiler::lexTime) << "ms\nTime spent by parser: " << std::to_string(Compiler::parseTime) << "ms\nTime spent by generator: " << std::to_string(Compiler::genTime) << "ms" << std::endl;
             return 0;
         }
@@ -121,6 +174,7 @@ int main(int argc, char** argv) {
     }
 
     Compiler::initialize(outFile, outType, options, files);
-    Compiler::compileAll();
-    return 0;
+    int status = Compiler::compileAll();
+    TimeTrace::write(Compiler::outFile + ".time-trace.json");
+    return status;
 }
\ No newline at end of file
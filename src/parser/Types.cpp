@@ -12,6 +12,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../include/parser/nodes/NodeInt.hpp"
 #include "../include/parser/nodes/NodeString.hpp"
 #include "../include/parser/nodes/NodeFloat.hpp"
+#include "../include/arena.hpp"
 #include <iostream>
 
 // Type
@@ -20,6 +21,7 @@ Type::~Type() {}
 
 // TypeBasic
 TypeBasic::TypeBasic(char ty) {
+    this->kind = Kind;
     this->type = ty;
 }
 
@@ -66,10 +68,12 @@ std::map<char, TypeBasic*> basicTypes;
 
 // TypePointer
 TypePointer::TypePointer(Type* instance) {
+    this->kind = Kind;
     this->instance = instance;
 }
 
 Type* TypePointer::copy() {
+    if(!this->mangled.empty()) return this;
     return new TypePointer(instance->copy());
 }
 
@@ -88,10 +92,10 @@ int TypePointer::getSize() {
     }
     return 64;
 }
-std::string TypePointer::toString() {return instance->toString() + "*";}
+std::string TypePointer::toString() {return this->mangled.empty() ? (instance->toString() + "*") : this->mangled;}
 Type* TypePointer::getElType() {
     while(instanceof<TypeConst>(instance)) instance = instance->getElType();
-    return instanceof<TypeVoid>(instance) ? new TypeBasic(BasicType::Char) : instance;
+    return instanceof<TypeVoid>(instance) ? basicTypes[BasicType::Char] : instance;
 }
 
 TypePointer::~TypePointer() {
@@ -100,12 +104,14 @@ TypePointer::~TypePointer() {
 
 // TypeArray
 TypeArray::TypeArray(Node* count, Type* element) {
+    this->kind = Kind;
     this->count = count;
     this->element = element;
 }
 
 Type* TypeArray::copy() {
-    return new TypeArray(count, element->copy());
+    if(!this->mangled.empty()) return this;
+    return new TypeArray((count == nullptr) ? nullptr : count->copy(), element->copy());
 }
 
 Type* TypeArray::check(Type* parent) {
@@ -114,7 +120,11 @@ Type* TypeArray::check(Type* parent) {
 }
 
 int TypeArray::getSize() {return ((NodeInt*)this->count->comptime())->value.to_int() * this->element->getSize();}
-std::string TypeArray::toString() {return this->element->toString() + "[" + std::to_string(((NodeInt*)this->count->comptime())->value.to_int()) + "]";}
+std::string TypeArray::toString() {
+    if(!this->mangled.empty()) return this->mangled;
+    return this->element->toString() + "[" + std::to_string(((NodeInt*)this->count->comptime())->value.to_int()) + "]";
+}
+
 Type* TypeArray::getElType() {return element;}
 
 TypeArray::~TypeArray() {
@@ -122,7 +132,7 @@ TypeArray::~TypeArray() {
 }
 
 // TypeAlias
-TypeAlias::TypeAlias() {}
+TypeAlias::TypeAlias() {this->kind = Kind;}
 Type* TypeAlias::copy() {return new TypeAlias();}
 std::string TypeAlias::toString() {return "alias";}
 Type* TypeAlias::check(Type* parent) {return nullptr;}
@@ -130,7 +140,7 @@ int TypeAlias::getSize() {return 0;}
 Type* TypeAlias::getElType() {return this;}
 
 // TypeVoid
-TypeVoid::TypeVoid() {}
+TypeVoid::TypeVoid() {this->kind = Kind;}
 Type* TypeVoid::check(Type* parent) {return nullptr;}
 Type* TypeVoid::copy() {return this;}
 int TypeVoid::getSize() {return 0;}
@@ -138,7 +148,7 @@ std::string TypeVoid::toString() {return "void";}
 Type* TypeVoid::getElType() {return this;}
 
 // TypeConst
-TypeConst::TypeConst(Type* instance) {this->instance = instance;}
+TypeConst::TypeConst(Type* instance) {this->kind = Kind; this->instance = instance;}
 Type* TypeConst::copy() {return new TypeConst(this->instance->copy());}
 Type* TypeConst::check(Type* parent) {this->instance->check(nullptr); return nullptr;}
 int TypeConst::getSize() {return this->instance->getSize();}
@@ -150,10 +160,12 @@ TypeConst::~TypeConst() {
 
 // TypeStruct
 TypeStruct::TypeStruct(std::string name) {
+    this->kind = Kind;
     this->name = name;
 }
 
 TypeStruct::TypeStruct(std::string name, std::vector<Type*> types) {
+    this->kind = Kind;
     this->name = name;
     this->types = types;
 }
@@ -279,6 +291,7 @@ Type* TypeStruct::getElType() {return this;}
 // TypeByval
 
 TypeByval::TypeByval(Type* type) {
+    this->kind = Kind;
     this->type = type;
 }
 
@@ -294,6 +307,7 @@ std::string TypeByval::toString() {return this->type->toString() + "*";}
 
 // TypeTemplateMember
 TypeTemplateMember::TypeTemplateMember(Type* type, Node* value) {
+    this->kind = Kind;
     this->type = type;
     this->value = value;
 }
@@ -317,6 +331,7 @@ TypeTemplateMember::~TypeTemplateMember() {
 
 // TypeTemplateMemberDefinition
 TypeTemplateMemberDefinition::TypeTemplateMemberDefinition(Type* type, std::string name) {
+    this->kind = Kind;
     this->type = type;
     this->name = name;
 }
@@ -333,6 +348,7 @@ TypeTemplateMemberDefinition::~TypeTemplateMemberDefinition() {
 
 // TypeFuncArg
 TypeFuncArg::TypeFuncArg(Type* type, std::string name) {
+    this->kind = Kind;
     this->type = type;
     this->name = name;
 }
@@ -349,6 +365,7 @@ TypeFuncArg::~TypeFuncArg() {
 
 // TypeFunc
 TypeFunc::TypeFunc(Type* main, std::vector<TypeFuncArg*> args, bool isVarArg) {
+    this->kind = Kind;
     this->main = main;
     this->args = args;
     this->isVarArg = isVarArg;
@@ -375,31 +392,41 @@ TypeFunc::~TypeFunc() {
 
 // TypeBuiltin
 TypeBuiltin::TypeBuiltin(std::string name, std::vector<Node*> args, NodeBlock* block) {
+    this->kind = Kind;
     this->name = name;
     this->args = args;
     this->block = block;
 }
 
 int TypeBuiltin::getSize() {return 0;}
-Type* TypeBuiltin::copy() {return new TypeBuiltin(this->name, this->args, (NodeBlock*)(this->block->copy()));}
+Type* TypeBuiltin::copy() {
+    std::vector<Node*> cArgs;
+    for(int i=0; i<this->args.size(); i++) cArgs.push_back(this->args[i]->copy());
+    return new TypeBuiltin(this->name, cArgs, (NodeBlock*)(this->block->copy()));
+}
 std::string TypeBuiltin::toString() {return this->name;}
 Type* TypeBuiltin::check(Type* parent) {return nullptr;}
 Type* TypeBuiltin::getElType() {return this;}
 
 // TypeCall
 TypeCall::TypeCall(std::string name, std::vector<Node*> args) {
+    this->kind = Kind;
     this->name = name;
     this->args = args;
 }
 
 std::string TypeCall::toString() {return "FuncCall";}
-Type* TypeCall::copy() {return new TypeCall(this->name, this->args);}
+Type* TypeCall::copy() {
+    std::vector<Node*> cArgs;
+    for(int i=0; i<this->args.size(); i++) cArgs.push_back(this->args[i]->copy());
+    return new TypeCall(this->name, cArgs);
+}
 int TypeCall::getSize() {return 0;}
 Type* TypeCall::check(Type* parent) {return nullptr;}
 Type* TypeCall::getElType() {return this;}
 
 // TypeAuto
-TypeAuto::TypeAuto() {}
+TypeAuto::TypeAuto() {this->kind = Kind;}
 Type* TypeAuto::copy() {return new TypeAuto();}
 int TypeAuto::getSize() {return 0;}
 Type* TypeAuto::check(Type* parent) {return nullptr;}
@@ -407,7 +434,7 @@ std::string TypeAuto::toString() {return "";}
 Type* TypeAuto::getElType() {return this;}
 
 // TypeLLVM
-TypeLLVM::TypeLLVM(LLVMTypeRef tr) {this->tr = tr;}
+TypeLLVM::TypeLLVM(LLVMTypeRef tr) {this->kind = Kind; this->tr = tr;}
 Type* TypeLLVM::copy() {return new TypeLLVM(this->tr);}
 int TypeLLVM::getSize() {return 0;}
 Type* TypeLLVM::check(Type* parent) {return nullptr;}
@@ -415,7 +442,7 @@ std::string TypeLLVM::toString() {return "";}
 Type* TypeLLVM::getElType() {return this;}
 
 // TypeVector
-TypeVector::TypeVector(Type* mainType, int count) {this->mainType = mainType; this->count = count;}
+TypeVector::TypeVector(Type* mainType, int count) {this->kind = Kind; this->mainType = mainType; this->count = count;}
 Type* TypeVector::copy() {return new TypeVector(mainType, count);}
 int TypeVector::getSize() {return mainType->getSize() * count;}
 Type* TypeVector::check(Type* parent) {return nullptr;}
@@ -423,7 +450,7 @@ std::string TypeVector::toString() {return "<" + mainType->toString() + " x " +
 Type* TypeVector::getElType() {return mainType;}
 
 // TypeDivided
-TypeDivided::TypeDivided(Type* mainType, std::vector<Type*> divided) {this->mainType = mainType; this->divided = divided;}
+TypeDivided::TypeDivided(Type* mainType, std::vector<Type*> divided) {this->kind = Kind; this->mainType = mainType; this->divided = divided;}
 Type* TypeDivided::copy() {return new TypeDivided(mainType, divided);}
 
 int TypeDivided::getSize() {
@@ -462,12 +489,13 @@ Type* getType(std::string id) {
         {"real", basicTypes[BasicType::Real]},
         {"void", typeVoid},
         {"alias", new TypeAlias()},
-        {"int4", new TypeVector(new TypeBasic(BasicType::Int), 4)},
-        {"int8", new TypeVector(new TypeBasic(BasicType::Int), 8)},
-        {"float4", new TypeVector(new TypeBasic(BasicType::Float), 4)},
-        {"float2", new TypeVector(new TypeBasic(BasicType::Float), 2)},
-        {"float8", new TypeVector(new TypeBasic(BasicType::Float), 8)},
-        {"short8", new TypeVector(new TypeBasic(BasicType::Short), 8)},
+        {"int4", new TypeVector(basicTypes[BasicType::Int], 4)},
+        {"int8", new TypeVector(basicTypes[BasicType::Int], 8)},
+        {"float4", new TypeVector(basicTypes[BasicType::Float], 4)},
+        {"float2", new TypeVector(basicTypes[BasicType::Float], 2)},
+        {"float8", new TypeVector(basicTypes[BasicType::Float], 8)},
+        {"short8", new TypeVector(basicTypes[BasicType::Short], 8)},
+        {"char16", new TypeVector(basicTypes[BasicType::Char], 16)},
     };
 
     auto it = types.find(id);
@@ -482,4 +510,70 @@ bool isFloatType(Type* type) {
 bool isBytePointer(Type* type) {
     std::string str = type->toString();
     return str == "void*" || str == "char*" || str == "uchar*";
+}
+
+// Interning
+
+// The key is the canonical element and the count of the array or -1 for the pointer
+static thread_local std::map<std::pair<Type*, int>, Type*> internedTypes;
+
+// Another basic type or void with the same kind is replaced by the canonical one
+static Type* toCanonical(Type* type) {
+    if(instanceof<TypeVoid>(type)) return typeVoid;
+    if(instanceof<TypeBasic>(type)) return basicTypes.at(((TypeBasic*)type)->type);
+    return type;
+}
+
+bool isCanonicalType(Type* type) {
+    if(instanceof<TypeBasic>(type)) return type == basicTypes.at(((TypeBasic*)type)->type);
+    if(instanceof<TypeVoid>(type)) return type == typeVoid;
+    if(instanceof<TypePointer>(type)) return !((TypePointer*)type)->mangled.empty();
+    if(instanceof<TypeArray>(type)) return !((TypeArray*)type)->mangled.empty();
+    return false;
+}
+
+// The interned types are placed in the persistent pool of the arena, so the cached imports can keep them between the compilations
+Type* getPointerType(Type* instance) {
+    instance = toCanonical(instance);
+    if(!Arena::isActive() || !isCanonicalType(instance)) return new TypePointer(instance);
+
+    auto it = internedTypes.find({instance, -1});
+    if(it != internedTypes.end()) return it->second;
+
+    Arena::Persistent persistent;
+    TypePointer* type = new TypePointer(instance);
+    type->mangled = instance->toString() + "*";
+    internedTypes[{instance, -1}] = type;
+    return type;
+}
+
+Type* getArrayType(Node* count, Type* element) {
+    element = toCanonical(element);
+    if(!Arena::isActive() || !instanceof<NodeInt>(count) || !isCanonicalType(element)) return new TypeArray(count, element);
+
+    int size = ((NodeInt*)count)->value.to_int();
+    if(size < 0) return new TypeArray(count, element);
+
+    auto it = internedTypes.find({element, size});
+    if(it != internedTypes.end()) return it->second;
+
+    Arena::Persistent persistent;
+    TypeArray* type = new TypeArray(((NodeInt*)count)->copy(), element);
+    type->mangled = element->toString() + "[" + std::to_string(size) + "]";
+    internedTypes[{element, size}] = type;
+    return type;
+}
+
+bool isSameType(Type* one, Type* two) {
+    if(one == two) return true;
+    if(isCanonicalType(one) && isCanonicalType(two)) return false;
+    return one->toString() == two->toString();
+}
+
+// The LLVM context of the compilation is disposed, so the LLVM types cached by the interned types are dropped
+void resetInternedTypes() {
+    for(auto& it : internedTypes) {
+        it.second->llvmType = nullptr;
+        it.second->llvmContext = nullptr;
+    }
 }
\ No newline at end of file
@@ -24,23 +24,25 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../include/llvm.hpp"
 #include "../include/utils.hpp"
 
-std::map<std::string, Type*> AST::aliasTypes;
-std::map<std::string, Node*> AST::aliasTable;
-std::map<std::string, NodeVar*> AST::varTable;
-std::map<std::string, NodeFunc*> AST::funcTable;
-std::map<std::string, NodeLambda*> AST::lambdaTable;
-std::map<std::string, NodeStruct*> AST::structTable;
-std::map<std::pair<std::string, std::string>, NodeFunc*> AST::methodTable;
-std::map<std::pair<std::string, std::string>, StructMember> AST::structsNumbers;
-std::vector<std::string> AST::importedFiles;
-std::map<std::string, std::vector<Node*>> AST::parsed;
-std::string AST::mainFile;
-std::vector<std::string> AST::addToImport;
+thread_local SymbolTable<std::string, Type*> AST::aliasTypes;
+thread_local SymbolTable<std::string, Node*> AST::aliasTable;
+thread_local SymbolTable<std::string, NodeVar*> AST::varTable;
+thread_local SymbolTable<std::string, NodeFunc*> AST::funcTable;
+thread_local SymbolTable<std::string, NodeLambda*> AST::lambdaTable;
+thread_local SymbolTable<std::string, NodeStruct*> AST::structTable;
+thread_local SymbolTable<std::pair<std::string, std::string>, NodeFunc*> AST::methodTable;
+thread_local SymbolTable<std::string, std::set<std::string>> AST::funcOverloads;
+thread_local SymbolTable<std::pair<std::string, std::string>, std::set<std::string>> AST::methodOverloads;
+thread_local SymbolTable<std::pair<std::string, std::string>, StructMember> AST::structsNumbers;
+thread_local std::vector<std::string> AST::importedFiles;
+thread_local std::map<std::string, std::vector<Node*>> AST::parsed;
+thread_local std::string AST::mainFile;
+thread_local std::vector<std::string> AST::addToImport;
 bool AST::debugMode;
 
-LLVMGen* generator = nullptr;
-Scope* currScope;
-LLVMTargetDataRef dataLayout;
+thread_local LLVMGen* generator = nullptr;
+thread_local Scope* currScope;
+thread_local LLVMTargetDataRef dataLayout;
 
 TypeFunc* callToTFunc(NodeCall* call) {
     std::vector<TypeFuncArg*> argTypes;
@@ -86,7 +88,7 @@ std::string typeToString(Type* arg) {
             TypeStruct* ts = (TypeStruct*)(((TypePointer*)arg)->instance);
             Type* t = ts;
             while(generator->toReplace.find(t->toString()) != generator->toReplace.end()) t = generator->toReplace[t->toString()];
-            if(!instanceof<TypeStruct>(t)) return typeToString(new TypePointer(t));
+            if(!instanceof<TypeStruct>(t)) return typeToString(getPointerType(t));
             ts = (TypeStruct*)t;
             if(ts->name.find('<') == std::string::npos) return "s-" + ts->name;
             else return "s-" + ts->name.substr(0, ts->name.find('<'));
@@ -168,8 +170,37 @@ std::string typesToString(std::vector<FuncArgSet> args) {
 }
 
 void AST::checkError(std::string message, int loc) {
-    std::cout << "\033[0;31mError on " + std::to_string(loc) + " line: " + message + "\033[0;0m\n";
-	exit(1);
+    Compiler::log() << "\033[0;31mError on " + std::to_string(loc) + " line: " + message + "\033[0;0m\n";
+	Compiler::exit(1);
+}
+
+// A call of 'f' resolves to 'f' and to the names that continue it with '[' or '<': 'f[_i]', 'f<int>', 'f<int>[_i]'
+static std::vector<std::string> overloadKeys(std::string const& name) {
+    std::vector<std::string> keys = {name};
+    for(size_t i=1; i<name.size(); i++) {
+        if(name[i] == '[' || name[i] == '<') keys.push_back(name.substr(0, i));
+    }
+    return keys;
+}
+
+void AST::addOverload(std::string const& name) {
+    for(auto& key : overloadKeys(name)) AST::funcOverloads[key].insert(name);
+}
+
+void AST::addMethodOverload(std::string const& structName, std::string const& name) {
+    for(auto& key : overloadKeys(name)) AST::methodOverloads[{structName, key}].insert(name);
+}
+
+static const std::set<std::string> noOverloads;
+
+std::set<std::string> const& AST::getOverloads(std::string const& name) {
+    auto it = AST::funcOverloads.find(name);
+    return (it == AST::funcOverloads.end()) ? noOverloads : it->second;
+}
+
+std::set<std::string> const& AST::getMethodOverloads(std::string const& structName, std::string const& name) {
+    auto it = AST::methodOverloads.find({structName, name});
+    return (it == AST::methodOverloads.end()) ? noOverloads : it->second;
 }
 
 LLVMGen::LLVMGen(std::string file, genSettings settings, nlohmann::json options) {
@@ -221,12 +252,12 @@ LLVMGen::LLVMGen(std::string file, genSettings settings, nlohmann::json options)
 }
 
 void LLVMGen::error(std::string msg, int line) {
-    std::cout << "\033[0;31mError in '" + this->file + "' file at " + std::to_string(line) + " line: " + msg + "\033[0;0m" << std::endl;
-    std::exit(1);
+    Compiler::log() << "\033[0;31mError in '" + this->file + "' file at " + std::to_string(line) + " line: " + msg + "\033[0;0m" << std::endl;
+    Compiler::exit(1);
 }
 
 void LLVMGen::warning(std::string msg, int line) {
-    std::cout << "\033[0;33mWarning in '" + this->file + "' file at " + std::to_string(line) + " line: " + msg + "\033[0;0m" << std::endl;
+    Compiler::log() << "\033[0;33mWarning in '" + this->file + "' file at " + std::to_string(line) + " line: " + msg + "\033[0;0m" << std::endl;
 }
 
 std::string LLVMGen::mangle(std::string name, bool isFunc, bool isMethod) {
@@ -268,73 +299,91 @@ Type* LLVMGen::setByTypeList(std::vector<Type*> list) {
 
 LLVMTypeRef LLVMGen::genType(Type* type, int loc) {
     if(type == nullptr) return LLVMPointerType(LLVMInt8TypeInContext(this->context), 0);
-    if(instanceof<TypeByval>(type)) return LLVMPointerType(generator->genType(type->getElType(), loc), 0);
-    if(instanceof<TypeAlias>(type)) return nullptr;
-    if(instanceof<TypeBasic>(type)) switch(((TypeBasic*)type)->type) {
-        case BasicType::Bool: return LLVMInt1TypeInContext(this->context);
-        case BasicType::Char: case BasicType::Uchar: return LLVMInt8TypeInContext(this->context);
-        case BasicType::Short: case BasicType::Ushort: return LLVMInt16TypeInContext(this->context);
-        case BasicType::Half: return LLVMHalfTypeInContext(this->context);
-        case BasicType::Bhalf: return LLVMBFloatTypeInContext(this->context);
-        case BasicType::Int: case BasicType::Uint: return LLVMInt32TypeInContext(this->context);
-        case BasicType::Long: case BasicType::Ulong: return LLVMInt64TypeInContext(this->context);
-        case BasicType::Cent: case BasicType::Ucent: return LLVMInt128TypeInContext(this->context);
-        case BasicType::Float: return LLVMFloatTypeInContext(this->context);
-        case BasicType::Double: return LLVMDoubleTypeInContext(this->context);
-        case BasicType::Real: return LLVMFP128TypeInContext(this->context);
-        default: return nullptr;
-    }
-    if(instanceof<TypePointer>(type)) {
-        if(instanceof<TypeVoid>(((TypePointer*)type)->instance)) return LLVMPointerType(LLVMInt8TypeInContext(this->context),0);
-        return LLVMPointerType(this->genType(((TypePointer*)type)->instance, loc),0);
-    }
-    if(instanceof<TypeArray>(type)) return LLVMArrayType(this->genType(((TypeArray*)type)->element, loc), ((NodeInt*)((TypeArray*)type)->count->comptime())->value.to_int());
-    if(instanceof<TypeStruct>(type)) {
-        TypeStruct* s = (TypeStruct*)type;
-        if(this->structures.find(s->name) == this->structures.end()) {
-            if(AST::structTable.find(s->name) != AST::structTable.end() && AST::structTable[s->name]->templateNames.size() > 0) {
-                generator->error("trying to generate template structure without templates!", loc);
+
+    // The interned pointers and arrays never change, so their LLVM type is generated once per context
+    if(type->llvmType != nullptr && type->llvmContext == this->context) return type->llvmType;
+
+    switch(type->kind) {
+        case TypeKind::Byval: return LLVMPointerType(generator->genType(type->getElType(), loc), 0);
+        case TypeKind::Alias: return nullptr;
+        case TypeKind::Basic: switch(((TypeBasic*)type)->type) {
+            case BasicType::Bool: return LLVMInt1TypeInContext(this->context);
+            case BasicType::Char: case BasicType::Uchar: return LLVMInt8TypeInContext(this->context);
+            case BasicType::Short: case BasicType::Ushort: return LLVMInt16TypeInContext(this->context);
+            case BasicType::Half: return LLVMHalfTypeInContext(this->context);
+            case BasicType::Bhalf: return LLVMBFloatTypeInContext(this->context);
+            case BasicType::Int: case BasicType::Uint: return LLVMInt32TypeInContext(this->context);
+            case BasicType::Long: case BasicType::Ulong: return LLVMInt64TypeInContext(this->context);
+            case BasicType::Cent: case BasicType::Ucent: return LLVMInt128TypeInContext(this->context);
+            case BasicType::Float: return LLVMFloatTypeInContext(this->context);
+            case BasicType::Double: return LLVMDoubleTypeInContext(this->context);
+            case BasicType::Real: return LLVMFP128TypeInContext(this->context);
+            default: return nullptr;
+        }
+        case TypeKind::Pointer: case TypeKind::Array: {
+            LLVMTypeRef generated;
+
+            if(type->kind == TypeKind::Pointer) {
+                if(instanceof<TypeVoid>(((TypePointer*)type)->instance)) generated = LLVMPointerType(LLVMInt8TypeInContext(this->context), 0);
+                else generated = LLVMPointerType(this->genType(((TypePointer*)type)->instance, loc), 0);
             }
+            else generated = LLVMArrayType(this->genType(((TypeArray*)type)->element, loc), ((NodeInt*)((TypeArray*)type)->count->comptime())->value.to_int());
 
-            if(this->toReplace.find(s->name) != this->toReplace.end()) {
-                return this->genType(this->toReplace[s->name], loc);
+            if(isCanonicalType(type)) {
+                type->llvmType = generated;
+                type->llvmContext = this->context;
             }
+            return generated;
+        }
+        case TypeKind::Struct: {
+            TypeStruct* s = (TypeStruct*)type;
+            if(this->structures.find(s->name) == this->structures.end()) {
+                if(AST::structTable.find(s->name) != AST::structTable.end() && AST::structTable[s->name]->templateNames.size() > 0) {
+                    generator->error("trying to generate template structure without templates!", loc);
+                }
 
-            if(s->name.find('<') != std::string::npos) {
-                TypeStruct* sCopy = (TypeStruct*)s->copy();
-                for(int i=0; i<sCopy->types.size(); i++) sCopy->types[i] = this->setByTypeList(getTrueTypeList(sCopy->types[i]));
-                sCopy->updateByTypes();
-                if(this->structures.find(sCopy->name) != this->structures.end()) return this->structures[sCopy->name];
-                std::string origStruct = sCopy->name.substr(0, sCopy->name.find('<'));
-                
-                if(AST::structTable.find(origStruct) != AST::structTable.end()) {
-                    return AST::structTable[origStruct]->genWithTemplate(sCopy->name.substr(sCopy->name.find('<'), sCopy->name.size()), sCopy->types);
+                if(this->toReplace.find(s->name) != this->toReplace.end()) {
+                    return this->genType(this->toReplace[s->name], loc);
                 }
-            }
 
-            if(AST::structTable.find(s->name) != AST::structTable.end()) {
-                AST::structTable[s->name]->check();
-                AST::structTable[s->name]->generate();
-                return this->genType(type, loc);
+                if(s->name.find('<') != std::string::npos) {
+                    TypeStruct* sCopy = (TypeStruct*)s->copy();
+                    for(int i=0; i<sCopy->types.size(); i++) sCopy->types[i] = this->setByTypeList(getTrueTypeList(sCopy->types[i]));
+                    sCopy->updateByTypes();
+                    if(this->structures.find(sCopy->name) != this->structures.end()) return this->structures[sCopy->name];
+                    std::string origStruct = sCopy->name.substr(0, sCopy->name.find('<'));
+                    
+                    if(AST::structTable.find(origStruct) != AST::structTable.end()) {
+                        return AST::structTable[origStruct]->genWithTemplate(sCopy->name.substr(sCopy->name.find('<'), sCopy->name.size()), sCopy->types);
+                    }
+                }
+
+                if(AST::structTable.find(s->name) != AST::structTable.end()) {
+                    AST::structTable[s->name]->check();
+                    AST::structTable[s->name]->generate();
+                    return this->genType(type, loc);
+                }
+                else if(AST::aliasTypes.find(s->name) != AST::aliasTypes.end()) return this->genType(AST::aliasTypes[s->name], loc);
+                
+                this->error("unknown structure '" + s->name + "'!", loc);
             }
-            else if(AST::aliasTypes.find(s->name) != AST::aliasTypes.end()) return this->genType(AST::aliasTypes[s->name], loc);
-            
-            this->error("unknown structure '" + s->name + "'!", loc);
+            return this->structures[s->name];
         }
-        return this->structures[s->name];
-    }
-    if(instanceof<TypeVoid>(type)) return LLVMVoidTypeInContext(this->context);
-    if(instanceof<TypeFunc>(type)) {
-        TypeFunc* tf = (TypeFunc*)type;
-        if(instanceof<TypeVoid>(tf->main)) tf->main = basicTypes[BasicType::Char];
-        std::vector<LLVMTypeRef> types;
-        for(int i=0; i<tf->args.size(); i++) types.push_back(this->genType(tf->args[i]->type, loc));
-        return LLVMPointerType(LLVMFunctionType(this->genType(tf->main, loc), types.data(), types.size(), false), 0);
+        case TypeKind::Void: return LLVMVoidTypeInContext(this->context);
+        case TypeKind::Func: {
+            TypeFunc* tf = (TypeFunc*)type;
+            if(instanceof<TypeVoid>(tf->main)) tf->main = basicTypes[BasicType::Char];
+            std::vector<LLVMTypeRef> types;
+            for(int i=0; i<tf->args.size(); i++) types.push_back(this->genType(tf->args[i]->type, loc));
+            return LLVMPointerType(LLVMFunctionType(this->genType(tf->main, loc), types.data(), types.size(), false), 0);
+        }
+        case TypeKind::FuncArg: return this->genType(((TypeFuncArg*)type)->type, loc);
+        case TypeKind::Const: return this->genType(((TypeConst*)type)->instance, loc);
+        case TypeKind::Vector: return LLVMVectorType(this->genType(((TypeVector*)type)->mainType, loc), ((TypeVector*)type)->count);
+        case TypeKind::LLVM: return ((TypeLLVM*)type)->tr;
+        default: break;
     }
-    if(instanceof<TypeFuncArg>(type)) return this->genType(((TypeFuncArg*)type)->type, loc);
-    if(instanceof<TypeConst>(type)) return this->genType(((TypeConst*)type)->instance, loc);
-    if(instanceof<TypeVector>(type)) return LLVMVectorType(this->genType(((TypeVector*)type)->mainType, loc), ((TypeVector*)type)->count);
-    if(instanceof<TypeLLVM>(type)) return ((TypeLLVM*)type)->tr;
+
     this->error("undefined type!", loc);
     return nullptr;
 }
@@ -345,7 +394,9 @@ RaveValue LLVMGen::byIndex(RaveValue value, std::vector<LLVMValueRef> indexes) {
     );
 
     if(instanceof<TypeArray>(value.type->getElType())) {
-        Type* newType = new TypePointer(value.type->getElType()->getElType());
+        // The pointer to the array is indexed as the pointer to its first element, so the LLVM value needs the same type
+        Type* newType = getPointerType(value.type->getElType()->getElType());
+        value.value = LLVMBuildPointerCast(generator->builder, value.value, genType(newType, -1), "arrayToPtr");
         value.type = newType;
     }
 
@@ -394,38 +445,93 @@ int LLVMGen::getAlignment(Type* type) {
     return 0;
 }
 
+// ScopeTable
+
+ScopeTable::Entry* ScopeTable::find(std::string const& name) {
+    auto it = this->entries.find(name);
+    return (it == this->entries.end()) ? nullptr : &it->second;
+}
+
+ScopeTable::Entry& ScopeTable::change(std::string const& name) {
+    Entry* entry = &this->entries[name];
+    this->changes.push_back({entry, *entry});
+    return *entry;
+}
+
+void ScopeTable::undo(size_t mark) {
+    while(this->changes.size() > mark) {
+        *this->changes.back().first = this->changes.back().second;
+        this->changes.pop_back();
+    }
+}
+
 // Scope
 
 Scope::Scope(std::string funcName, std::map<std::string, int> args, std::map<std::string, NodeVar*> argVars) {
     this->funcName = funcName;
-    this->args = std::map<std::string, int>(args);
-    this->argVars = std::map<std::string, NodeVar*>(argVars);
-    this->aliasTable = std::map<std::string, Node*>();
-    this->localScope = std::map<std::string, RaveValue>();
-    this->localVars = std::map<std::string, NodeVar*>();
+    for(auto& arg : args) this->names.change(arg.first).arg = arg.second;
+    for(auto& var : argVars) this->names.change(var.first).argVar = var.second;
+}
+
+// Starts a nested block: the names declared in it and its changes of the block state are dropped by pop
+void Scope::push() {
+    this->levels.push_back(Level{this->names.mark(), this->funcHasRet, this->blockExit, this->elseIfEnd, this->detectMemoryLeaks});
+    this->elseIfEnd = nullptr;
+    this->detectMemoryLeaks = false;
+}
+
+void Scope::pop() {
+    Level level = this->levels.back();
+    this->levels.pop_back();
+
+    this->names.undo(level.mark);
+    this->funcHasRet = level.funcHasRet;
+    this->blockExit = level.blockExit;
+    this->elseIfEnd = level.elseIfEnd;
+    this->detectMemoryLeaks = level.detectMemoryLeaks;
+}
+
+RaveValue Scope::getLocal(std::string const& name) {
+    ScopeTable::Entry* entry = this->names.find(name);
+    return (entry == nullptr) ? RaveValue{nullptr, nullptr} : entry->value;
 }
 
+void Scope::setLocal(std::string const& name, RaveValue value) {this->names.change(name).value = value;}
+void Scope::setVar(std::string const& name, NodeVar* var) {this->names.change(name).var = var;}
+
+Node* Scope::getAlias(std::string const& name) {
+    ScopeTable::Entry* entry = this->names.find(name);
+    return (entry == nullptr) ? nullptr : entry->alias;
+}
+
+void Scope::setAlias(std::string const& name, Node* value) {this->names.change(name).alias = value;}
+
 void Scope::remove(std::string name) {
-    if(this->localScope.find(name) != this->localScope.end()) {
-        this->localScope.erase(name);
-        this->localVars.erase(name);
+    ScopeTable::Entry* entry = this->names.find(name);
+    if(entry == nullptr) return;
+
+    if(entry->value.value != nullptr) {
+        ScopeTable::Entry& changed = this->names.change(name);
+        changed.value = {nullptr, nullptr};
+        changed.var = nullptr;
     }
-    else if(this->aliasTable.find(name) != this->aliasTable.end()) this->aliasTable.erase(name);
+    else if(entry->alias != nullptr) this->names.change(name).alias = nullptr;
 }
 
 RaveValue Scope::get(std::string name, int loc) {
     RaveValue value = {nullptr, nullptr};
+    ScopeTable::Entry* entry = this->names.find(name);
 
     if(AST::aliasTable.find(name) != AST::aliasTable.end()) value = AST::aliasTable[name]->generate();
     else if(generator->toReplaceValues.find(name) != generator->toReplaceValues.end()) value = generator->toReplaceValues[name]->generate();
-    else if(this->aliasTable.find(name) != this->aliasTable.end()) value = this->aliasTable[name]->generate();
-    else if(localScope.find(name) != localScope.end()) value = localScope[name];
+    else if(entry != nullptr && entry->alias != nullptr) value = entry->alias->generate();
+    else if(entry != nullptr && entry->value.value != nullptr) value = entry->value;
     else if(generator->globals.find(name) != generator->globals.end()) value = generator->globals[name];
     else if(generator->functions.find(this->funcName) != generator->functions.end()) {
-        if(this->args.find(name) == this->args.end()) {
+        if(entry == nullptr || entry->arg < 0) {
             if(generator->functions.find(name) != generator->functions.end()) generator->error(name, loc);
         }
-        else return {LLVMGetParam(generator->functions[this->funcName].value, this->args[name]), AST::funcTable[this->funcName]->getArgType(name)};
+        else return {LLVMGetParam(generator->functions[this->funcName].value, entry->arg), AST::funcTable[this->funcName]->getArgType(name)};
     }
     
     if(value.value == nullptr && hasAtThis(name)) {
@@ -446,10 +552,12 @@ RaveValue Scope::get(std::string name, int loc) {
 }
 
 RaveValue Scope::getWithoutLoad(std::string name, int loc) {
+    ScopeTable::Entry* entry = this->names.find(name);
+
     if(generator->toReplaceValues.find(name) != generator->toReplaceValues.end()) return generator->toReplaceValues[name]->generate();
     if(AST::aliasTable.find(name) != AST::aliasTable.end()) return AST::aliasTable[name]->generate();
-    if(this->aliasTable.find(name) != this->aliasTable.end()) return this->aliasTable[name]->generate();
-    if(this->localScope.find(name) != this->localScope.end()) return this->localScope[name];
+    if(entry != nullptr && entry->alias != nullptr) return entry->alias->generate();
+    if(entry != nullptr && entry->value.value != nullptr) return entry->value;
     if(generator->globals.find(name) != generator->globals.end()) return generator->globals[name];
     if(hasAtThis(name)) {
         NodeVar* nv = this->getVar("this", loc);
@@ -462,16 +570,16 @@ RaveValue Scope::getWithoutLoad(std::string name, int loc) {
             return nget->generate();
         }
     }
-    if(this->args.find(name) == this->args.end()) generator->error("undefined identifier '" + name + "' at function '" + this->funcName + "'!", loc);
-    return {LLVMGetParam(generator->functions[this->funcName].value, this->args[name]), AST::funcTable[this->funcName]->getArgType(name)};
+    if(entry == nullptr || entry->arg < 0) generator->error("undefined identifier '" + name + "' at function '" + this->funcName + "'!", loc);
+    return {LLVMGetParam(generator->functions[this->funcName].value, entry->arg), AST::funcTable[this->funcName]->getArgType(name)};
 }
 
 bool Scope::has(std::string name) {
+    ScopeTable::Entry* entry = this->names.find(name);
+
     return AST::aliasTable.find(name) != AST::aliasTable.end() ||
-        this->aliasTable.find(name) != this->aliasTable.end() ||
-        this->localScope.find(name) != this->localScope.end() ||
-        generator->globals.find(name) != generator->globals.end() ||
-        this->args.find(name) != this->args.end();
+        (entry != nullptr && (entry->alias != nullptr || entry->value.value != nullptr || entry->arg >= 0)) ||
+        generator->globals.find(name) != generator->globals.end();
 }
 
 bool Scope::hasAtThis(std::string name) {
@@ -486,21 +594,24 @@ bool Scope::hasAtThis(std::string name) {
 }
 
 bool Scope::locatedAtThis(std::string name) {
+    ScopeTable::Entry* entry = this->names.find(name);
+
     if(AST::aliasTable.find(name) != AST::aliasTable.end()) return false;
-    if(this->aliasTable.find(name) != this->aliasTable.end()) return false;
-    if(this->localScope.find(name) != this->localScope.end()) return false;
+    if(entry != nullptr && (entry->alias != nullptr || entry->value.value != nullptr)) return false;
     if(generator->globals.find(name) != generator->globals.end()) return false;
     return this->hasAtThis(name);
 }
 
 NodeVar* Scope::getVar(std::string name, int loc) {
-    if(this->localVars.find(name) != this->localVars.end()) return this->localVars[name];
+    ScopeTable::Entry* entry = this->names.find(name);
+
+    if(entry != nullptr && entry->var != nullptr) return entry->var;
     if(AST::varTable.find(name) != AST::varTable.end()) return AST::varTable[name];
-    if(this->argVars.find(name) != this->argVars.end()) {
-        this->argVars[name]->isUsed = true;
-        return this->argVars[name];
+    if(entry != nullptr && entry->argVar != nullptr) {
+        entry->argVar->isUsed = true;
+        return entry->argVar;
     }
-    if(this->aliasTable.find(name) != this->aliasTable.end()) return (new NodeVar(name, this->aliasTable[name]->copy(), false, false, false, {}, loc, this->aliasTable[name]->getType()));
+    if(entry != nullptr && entry->alias != nullptr) return (new NodeVar(name, entry->alias->copy(), false, false, false, {}, loc, entry->alias->getType()));
     if(this->has("this") && (AST::funcTable.find(this->funcName) != AST::funcTable.end() && AST::funcTable[this->funcName]->isMethod)) {
         NodeVar* nv = this->getVar("this", loc);
         TypeStruct* ts = nullptr;
@@ -516,19 +627,16 @@ NodeVar* Scope::getVar(std::string name, int loc) {
 }
 
 void Scope::hasChanged(std::string name) {
-    if(this->localVars.find(name) != this->localVars.end()) ((NodeVar*)this->localVars[name])->isChanged = true;
+    ScopeTable::Entry* entry = this->names.find(name);
+
+    if(entry != nullptr && entry->var != nullptr) entry->var->isChanged = true;
     if(AST::varTable.find(name) != AST::varTable.end()) AST::varTable[name]->isChanged = true;
-    if(this->argVars.find(name) != this->argVars.end()) ((NodeVar*)this->argVars[name])->isChanged = true;
+    if(entry != nullptr && entry->argVar != nullptr) entry->argVar->isChanged = true;
 }
 
-Scope* copyScope(Scope* original) {
-    Scope* newScope = new Scope(original->funcName, original->args, original->argVars);
-    newScope->fnEnd = original->fnEnd;
-    newScope->funcHasRet = original->funcHasRet;
-    newScope->localVars = original->localVars;
-    newScope->localScope = original->localScope;
-    newScope->aliasTable = original->aliasTable;
-    return newScope;
+void Scope::markUsed(std::string const& name) {
+    ScopeTable::Entry* entry = this->names.find(name);
+    if(entry != nullptr && entry->var != nullptr) entry->var->isUsed = true;
 }
 
 std::string typeToString(LLVMTypeRef type) {return std::string(LLVMPrintTypeToString(type));}
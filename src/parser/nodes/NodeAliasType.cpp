@@ -11,6 +11,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/ast.hpp"
 
 NodeAliasType::NodeAliasType(std::string name, Type* value, int loc) {
+    this->kind = Kind;
     this->name = name;
     this->origName = name;
     this->value = value;
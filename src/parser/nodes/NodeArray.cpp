@@ -11,12 +11,13 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/llvm.hpp"
 
 NodeArray::NodeArray(int loc, std::vector<Node*> values) {
+    this->kind = Kind;
     this->loc = loc;
     this->values = std::vector<Node*>(values);
 }
 
 Type* NodeArray::getType() {
-    if(this->values.size() > 0) return new TypeArray(new NodeInt(this->values.size()), this->values[0]->getType());
+    if(this->values.size() > 0) return getArrayType(new NodeInt(this->values.size()), this->values[0]->getType());
     return typeVoid;
 }
 
@@ -43,7 +44,7 @@ RaveValue NodeArray::generate() {
     // If this is a constant array - just return LLVM constant array with provided values
     if(isConst) return LLVM::makeCArray(this->type, genValues);
 
-    RaveValue arr = LLVM::alloc(new TypeArray(new NodeInt(this->values.size()), this->type), "NodeArray");
+    RaveValue arr = LLVM::alloc(getArrayType(new NodeInt(this->values.size()), this->type), "NodeArray");
 
     for(int i=0; i<this->values.size(); i++) {
         LLVMBuildStore(generator->builder, genValues[i].value, generator->byIndex(arr, std::vector<LLVMValueRef>({LLVM::makeInt(32, i, false)})).value);
@@ -54,4 +55,8 @@ RaveValue NodeArray::generate() {
 
 void NodeArray::check() {this->isChecked = true;}
 Node* NodeArray::comptime() {return this;}
-Node* NodeArray::copy() {return new NodeArray(this->loc, this->values);}
\ No newline at end of file
+Node* NodeArray::copy() {
+    std::vector<Node*> cValues;
+    for(int i=0; i<this->values.size(); i++) cValues.push_back(this->values[i]->copy());
+    return new NodeArray(this->loc, cValues);
+}
\ No newline at end of file
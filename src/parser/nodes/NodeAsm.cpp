@@ -10,6 +10,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/llvm.hpp"
 
 NodeAsm::NodeAsm(std::string line, bool isVolatile, Type* type, std::string additions, std::vector<Node*> values, int loc) {
+    this->kind = Kind;
     this->line = line;
     this->isVolatile = isVolatile;
     this->type = type;
@@ -61,6 +61,7 @@ void Binary::store(RaveValue pointer, RaveValue value, int loc) {
 }
 
 NodeBinary::NodeBinary(char op, Node* first, Node* second, int loc, bool isStatic) {
+    this->kind = Kind;
     this->op = op;
     this->first = first;
     this->second = second;
@@ -118,8 +119,8 @@ Node* NodeBinary::comptime() {
         }
 
         switch(this->op) {
-            case TokType::Equal: return new NodeBool(firstType->toString() == secondType->toString());
-            case TokType::Nequal: return new NodeBool(firstType->toString() != secondType->toString());
+            case TokType::Equal: return new NodeBool(isSameType(firstType, secondType));
+            case TokType::Nequal: return new NodeBool(!isSameType(firstType, secondType));
             default: return new NodeBool(false);
         }
     }
@@ -271,7 +272,7 @@ RaveValue Binary::operation(char op, Node* first, Node* second, int loc) {
             if(nvar->isConst && nvar->isChanged && id->name != "this") generator->error("an attempt to change the value of a constant variable!", loc);
             else if(!nvar->isChanged) currScope->hasChanged(id->name);
 
-            if(currScope->localVars.find(id->name) != currScope->localVars.end()) currScope->localVars[id->name]->isUsed = true;
+            currScope->markUsed(id->name);
 
             RaveValue vFirst = currScope->getWithoutLoad(id->name, loc);
             RaveValue vSecond = second->generate();
@@ -295,7 +296,7 @@ RaveValue Binary::operation(char op, Node* first, Node* second, int loc) {
                     generator->error("an attempt to change value of the structure as the variable '" + id->name + "' without overloading!", loc);
             }
 
-            if(vSecond.type && vSecond.type->toString() == vFirst.type->toString()) vSecond = LLVM::load(vSecond, "NodeBinary_NodeIden_load", loc);
+            if(vSecond.type && isSameType(vSecond.type, vFirst.type)) vSecond = LLVM::load(vSecond, "NodeBinary_NodeIden_load", loc);
 
             if(instanceof<TypeArray>(vFirst.type->getElType()) && instanceof<TypePointer>(vSecond.type)) generator->error("cannot store a value of type " + vSecond.type->toString() + " into a variable of type " + vFirst.type->getElType()->toString() + "!", loc);
 
@@ -335,7 +336,7 @@ RaveValue Binary::operation(char op, Node* first, Node* second, int loc) {
 
                 if(instanceof<TypeBasic>(number.type) && ((TypeBasic*)number.type)->type != ((TypeBasic*)elType)->type) LLVM::cast(number, elType, loc);
 
-                if(number.type->toString() != elType->toString()) generator->error("cannot store a value of type " + number.type->toString() + " into a value of type " + elType->toString() + "!", loc);
+                if(!isSameType(number.type, elType)) generator->error("cannot store a value of type " + number.type->toString() + " into a value of type " + elType->toString() + "!", loc);
 
                 if(instanceof<TypePointer>(ptr.type)) {
                     value = LLVM::load(ptr, "NodeBinary_TypeVector_load", loc);
@@ -440,7 +441,7 @@ RaveValue Binary::operation(char op, Node* first, Node* second, int loc) {
         return (out->generate());
     }
 
-    if(vFirst.type->toString() != vSecond.type->toString()) {
+    if(!isSameType(vFirst.type, vSecond.type)) {
         if(!instanceof<TypeBasic>(vFirst.type) || !instanceof<TypeBasic>(vSecond.type)) generator->error("value types '" + vFirst.type->toString() + "' and '" + vSecond.type->toString() + "' are incompatible!", loc);
     }
 
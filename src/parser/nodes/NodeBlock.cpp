@@ -14,6 +14,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/utils.hpp"
 
 NodeBlock::NodeBlock(std::vector<Node*> nodes) {
+    this->kind = Kind;
     this->nodes = std::vector<Node*>(nodes);
 }
 
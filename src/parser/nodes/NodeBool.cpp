@@ -8,7 +8,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/utils.hpp"
 #include "../../include/parser/ast.hpp"
 
-NodeBool::NodeBool(bool value) {this->value = value;}
+NodeBool::NodeBool(bool value) {this->kind = Kind; this->value = value;}
 void NodeBool::check() {this->isChecked = true;}
 RaveValue NodeBool::generate() {return {LLVM::makeInt(1, value, false), basicTypes[BasicType::Bool]};}
 Type* NodeBool::getType() {return basicTypes[BasicType::Bool];}
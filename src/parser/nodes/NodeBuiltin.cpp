@@ -33,6 +33,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/compiler.hpp"
 
 NodeBuiltin::NodeBuiltin(std::string name, std::vector<Node*> args, int loc, NodeBlock* block) {
+    this->kind = Kind;
     this->name = name;
     this->args = std::vector<Node*>(args);
     this->loc = loc;
@@ -40,6 +41,7 @@ NodeBuiltin::NodeBuiltin(std::string name, std::vector<Node*> args, int loc, Nod
 }
 
 NodeBuiltin::NodeBuiltin(std::string name, std::vector<Node*> args, int loc, NodeBlock* block, Type* type, bool isImport, bool isTopLevel, int CTId) {
+    this->kind = Kind;
     this->name = name;
     this->args = std::vector<Node*>(args);
     this->loc = loc;
@@ -57,8 +59,11 @@ NodeBuiltin::~NodeBuiltin() {
 }
 
 Node* NodeBuiltin::copy() {
+    std::vector<Node*> cArgs;
+    for(int i=0; i<this->args.size(); i++) cArgs.push_back(this->args[i] == nullptr ? nullptr : this->args[i]->copy());
+
     return new NodeBuiltin(
-        this->name, this->args, this->loc,
+        this->name, cArgs, this->loc,
         (NodeBlock*)this->block->copy(), (this->type == nullptr ? nullptr : this->type->copy()), this->isImport,
         this->isTopLevel, this->CTId
     );
@@ -71,12 +76,14 @@ Type* NodeBuiltin::getType() {
     if(this->name == "isNumeric" || this->name == "isVector" || this->name == "isPointer"
     || this->name == "isArray" || this->name == "aliasExists" || this->name == "tEquals"
     || this->name == "isStructure" || this->name == "hasMethod"
-    || this->name == "hasDestructor" || this->name == "contains" || this->name == "isUnsigned") return basicTypes[BasicType::Bool];
+    || this->name == "hasDestructor" || this->name == "contains" || this->name == "isUnsigned"
+    || this->name == "isFloat") return basicTypes[BasicType::Bool];
     if(this->name == "sizeOf" || this->name == "argsLength" || this->name == "getCurrArgNumber"
     || this->name == "vMoveMask128" || this->name == "cttz32" || this->name == "ctlz32") return basicTypes[BasicType::Int];
     if(this->name == "vShuffle" || this->name == "vHAdd32x4" || this->name == "vHAdd16x8"
     || this->name == "vSumAll") return args[0]->getType();
-    if(this->name == "typeToString") return new TypePointer(basicTypes[BasicType::Char]);
+    if(this->name == "crc32c") return basicTypes[BasicType::Uint];
+    if(this->name == "typeToString") return getPointerType(basicTypes[BasicType::Char]);
     if(this->name == "minOf" || this->name == "maxOf") return basicTypes[BasicType::Ulong];
     return typeVoid;
 }
@@ -117,6 +124,7 @@ NodeType* NodeBuiltin::asType(int n, bool isCompTime) {
         if(name == "int4") return new NodeType(new TypeVector(basicTypes[BasicType::Int], 4), this->loc);
         if(name == "int8") return new NodeType(new TypeVector(basicTypes[BasicType::Int], 8), this->loc);
         if(name == "short8") return new NodeType(new TypeVector(basicTypes[BasicType::Short], 8), this->loc);
+        if(name == "char16") return new NodeType(new TypeVector(basicTypes[BasicType::Char], 16), this->loc);
         return new NodeType(new TypeStruct(name), this->loc);
     }
     if(instanceof<NodeBuiltin>(this->args[n])) {
@@ -240,7 +248,7 @@ RaveValue NodeBuiltin::generate() {
         RaveValue result = {nullptr, nullptr};
 
         if(ty->isFloat()) {
-            if(ty->toString() != two.type->toString()) {
+            if(!isSameType(ty, two.type)) {
                 if(ty->type == BasicType::Double) {
                     two.value = LLVMBuildFPCast(generator->builder, two.value, generator->genType(ty, loc), "NodeBuiltin_fmodf_ftod");
                     two.type = ty;
@@ -320,7 +328,7 @@ RaveValue NodeBuiltin::generate() {
     else if(this->name == "tEquals") {
         if(this->args.size() < 2) generator->error("at least two arguments are required!", this->loc);
 
-        if(this->asType(0)->type->toString() == this->asType(1)->type->toString()) return {LLVM::makeInt(1, 1, false), basicTypes[BasicType::Bool]};
+        if(isSameType(this->asType(0)->type, this->asType(1)->type)) return {LLVM::makeInt(1, 1, false), basicTypes[BasicType::Bool]};
         return {LLVM::makeInt(1, 1, false), basicTypes[BasicType::Bool]};
     }
     else if(this->name == "isArray") {
@@ -373,7 +381,10 @@ RaveValue NodeBuiltin::generate() {
 
         std::string iden = this->asStringIden(0);
         if(iden[0] == '<') AST::addToImport.push_back(exePath + iden.substr(1, iden.size()-1) + ".rave");
-        else AST::addToImport.push_back(getDirectory3(AST::mainFile) + "/" + iden.substr(1, iden.size()-1) + ".rave");
+        else {
+            AST::addToImport.push_back(getDirectory3(AST::mainFile) + "/" + iden.substr(1, iden.size()-1) + ".rave");
+            if(Compiler::currentJob != nullptr) Compiler::currentJob->usesMainDirectory = true;
+        }
         return {};
     }
     else if(this->name == "isStructure") {
@@ -394,10 +405,16 @@ RaveValue NodeBuiltin::generate() {
         if(instanceof<TypeBasic>(asType(0)->type)) return {LLVM::makeInt(1, ((TypeBasic*)asType(0)->type)->isUnsigned(), false), basicTypes[BasicType::Bool]};
         return {LLVM::makeInt(1, 0, false), basicTypes[BasicType::Bool]};
     }
+    else if(this->name == "isFloat") {
+        if(this->args.size() < 1) generator->error("at least one argument is required!", this->loc);
+
+        if(instanceof<TypeBasic>(asType(0)->type)) return {LLVM::makeInt(1, ((TypeBasic*)asType(0)->type)->isFloat(), false), basicTypes[BasicType::Bool]};
+        return {LLVM::makeInt(1, 0, false), basicTypes[BasicType::Bool]};
+    }
     else if(this->name == "echo") {
         std::string buffer = "";
         for(int i=0; i<this->args.size(); i++) buffer += this->asStringIden(i);
-        std::cout << buffer << std::endl;
+        Compiler::log() << buffer << std::endl;
         return {};
     }
     else if(this->name == "warning") {
@@ -417,7 +434,8 @@ RaveValue NodeBuiltin::generate() {
     else if(this->name == "addLibrary") {
         if(this->args.size() < 1) generator->error("at least one argument is required!", this->loc);
 
-        Compiler::linkString += " -l" + asStringIden(0) + " ";
+        if(Compiler::currentJob != nullptr) Compiler::currentJob->linkString += " -l" + asStringIden(0) + " ";
+        else Compiler::linkString += " -l" + asStringIden(0) + " ";
         return {};
     }
     else if(this->name == "return") {
@@ -519,7 +537,7 @@ RaveValue NodeBuiltin::generate() {
             generator->builder, value.value,
             LLVMPointerType(LLVMStructTypeInContext(generator->context, std::vector<LLVMTypeRef>({generator->genType(resultVectorType, this->loc)}).data(), 1, false), 0),
             "vLoad_bitc"
-        ), new TypePointer(new TypeStruct(sName))}, 0, "vLoad_sgep"), "vLoad", loc);
+        ), getPointerType(new TypeStruct(sName))}, 0, "vLoad_sgep"), "vLoad", loc);
 
         if(!alignment) LLVMSetAlignment(v.value, 1);
         return v;
@@ -548,7 +566,7 @@ RaveValue NodeBuiltin::generate() {
             generator->builder, dataPtr.value,
             LLVMPointerType(LLVMStructTypeInContext(generator->context, std::vector<LLVMTypeRef>({LLVMTypeOf(vector.value)}).data(), 1, false), 0),
             "vStore_bitc"
-        ), new TypePointer(new TypeStruct(sName))}, 0, "vStore_sgep").value);
+        ), getPointerType(new TypeStruct(sName))}, 0, "vStore_sgep").value);
 
         if(!alignment) LLVMSetAlignment(vPtr, 1);
         return {};
@@ -610,7 +628,7 @@ RaveValue NodeBuiltin::generate() {
         if(instanceof<TypePointer>(vector2.type)) vector2 = LLVM::load(vector2, "VHAdd32x4_load2_", loc);
 
         if(!instanceof<TypeVector>(vector1.type) || !instanceof<TypeVector>(vector2.type)) generator->error("the values must have the vector type!", this->loc);
-        if(vector1.type->getElType()->toString() != vector2.type->getElType()->toString()) generator->error("the values must have the same type!", this->loc);
+        if(!isSameType(vector1.type->getElType(), vector2.type->getElType())) generator->error("the values must have the same type!", this->loc);
 
         if(!((TypeBasic*)vector1.type->getElType())->isFloat()) return LLVM::call(generator->functions["llvm.x86.ssse3.phadd.d.128"], std::vector<LLVMValueRef>({vector1.value, vector2.value}).data(), 2, "vHAdd32x4");
         return LLVM::call(generator->functions["llvm.x86.sse3.hadd.ps"], std::vector<LLVMValueRef>({vector1.value, vector2.value}).data(), 2, "vHAdd32x4");
@@ -630,7 +648,7 @@ RaveValue NodeBuiltin::generate() {
         if(instanceof<TypePointer>(vector2.type)) vector2 = LLVM::load(vector2, "VHAdd16x8_load2_", loc);
 
         if(!instanceof<TypeVector>(vector1.type) || !instanceof<TypeVector>(vector2.type)) generator->error("the values must have the vector type!", this->loc);
-        if(vector1.type->getElType()->toString() != vector2.type->getElType()->toString()) generator->error("the values must have the same type!", this->loc);
+        if(!isSameType(vector1.type->getElType(), vector2.type->getElType())) generator->error("the values must have the same type!", this->loc);
 
         return LLVM::call(generator->functions["llvm.x86.ssse3.phadd.sw.128"], std::vector<LLVMValueRef>({vector1.value, vector2.value}).data(), 2, "vHAdd16x8");
     }
@@ -699,11 +717,44 @@ RaveValue NodeBuiltin::generate() {
                 LLVMInt32TypeInContext(generator->context),
                 std::vector<LLVMTypeRef>({LLVMInt32TypeInContext(generator->context), LLVMInt1TypeInContext(generator->context)}).data(),
                 2, false
-            )), new TypeFunc(new TypeBasic(BasicType::Int), {new TypeFuncArg(new TypeBasic(BasicType::Int), "value"), new TypeFuncArg(new TypeBasic(BasicType::Bool), "isZeroPoison")}, false)};
+            )), new TypeFunc(basicTypes[BasicType::Int], {new TypeFuncArg(basicTypes[BasicType::Int], "value"), new TypeFuncArg(basicTypes[BasicType::Bool], "isZeroPoison")}, false)};
         }
 
         return LLVM::call(generator->functions["llvm.cttz.i32"], std::vector<LLVMValueRef>({value.value, isZeroPoison.value}).data(), 2, "cttz32");
     }
+    else if(this->name == "crc32c") {
+        if(Compiler::features.find("+sse4.2") == std::string::npos) {
+            generator->error("your target does not supports SSE4.2!", this->loc);
+            return {};
+        }
+
+        if(this->args.size() < 2) generator->error("at least two arguments are required!", this->loc);
+
+        RaveValue crc = this->args[0]->generate();
+        RaveValue value = this->args[1]->generate();
+
+        if(!instanceof<TypeBasic>(value.type) || ((TypeBasic*)value.type)->isFloat()) generator->error("the value must have the integer type!", this->loc);
+
+        // The instruction is chosen by the size of the value: 8, 16, 32 or 64 bits
+        int size = value.type->getSize();
+        if(size != 8 && size != 16 && size != 32 && size != 64) generator->error("the value must have the size of 8, 16, 32 or 64 bits!", this->loc);
+
+        std::string name = "llvm.x86.sse42.crc32." + std::string(size == 64 ? "64" : "32") + "." + std::to_string(size);
+        LLVMTypeRef crcType = (size == 64) ? LLVMInt64TypeInContext(generator->context) : LLVMInt32TypeInContext(generator->context);
+        Type* crcRaveType = (size == 64) ? basicTypes[BasicType::Ulong] : basicTypes[BasicType::Uint];
+
+        if(generator->functions.find(name) == generator->functions.end()) {
+            generator->functions[name] = {LLVMAddFunction(generator->lModule, name.c_str(), LLVMFunctionType(
+                crcType, std::vector<LLVMTypeRef>({crcType, LLVMIntTypeInContext(generator->context, size)}).data(), 2, false
+            )), new TypeFunc(crcRaveType, {new TypeFuncArg(crcRaveType, "crc"), new TypeFuncArg(value.type, "value")}, false)};
+        }
+
+        crc.value = LLVMBuildIntCast2(generator->builder, crc.value, crcType, false, "crc32c_itoi");
+        RaveValue result = LLVM::call(generator->functions[name], std::vector<LLVMValueRef>({crc.value, value.value}).data(), 2, "crc32c");
+
+        if(size == 64) result = {LLVMBuildTrunc(generator->builder, result.value, LLVMInt32TypeInContext(generator->context), "crc32c_trunc"), basicTypes[BasicType::Uint]};
+        return result;
+    }
     else if(this->name == "ctlz32") {
         if(this->args.size() < 2) generator->error("at least two arguments are required!", this->loc);
 
@@ -715,18 +766,44 @@ RaveValue NodeBuiltin::generate() {
                 LLVMInt32TypeInContext(generator->context),
                 std::vector<LLVMTypeRef>({LLVMInt32TypeInContext(generator->context), LLVMInt1TypeInContext(generator->context)}).data(),
                 2, false
-            )), new TypeFunc(new TypeBasic(BasicType::Int), {new TypeFuncArg(new TypeBasic(BasicType::Int), "value"), new TypeFuncArg(new TypeBasic(BasicType::Bool), "isZeroPoison")}, false)};
+            )), new TypeFunc(basicTypes[BasicType::Int], {new TypeFuncArg(basicTypes[BasicType::Int], "value"), new TypeFuncArg(basicTypes[BasicType::Bool], "isZeroPoison")}, false)};
         }
 
         return LLVM::call(generator->functions["llvm.ctlz.i32"], std::vector<LLVMValueRef>({value.value, isZeroPoison.value}).data(), 2, "ctlz32");
     }
+    else if(this->name == "memcpy" || this->name == "memmove" || this->name == "memset") {
+        if(this->args.size() < 3) generator->error("at least three arguments are required!", this->loc);
+
+        RaveValue dest = this->args[0]->generate();
+        RaveValue source = this->args[1]->generate();
+        RaveValue size = this->args[2]->generate();
+
+        if(!instanceof<TypePointer>(dest.type)) generator->error("the first argument must be a pointer!", this->loc);
+        if(!instanceof<TypeBasic>(size.type) || ((TypeBasic*)size.type)->isFloat()) generator->error("the size must have the integer type!", this->loc);
+
+        // Lowered to the llvm.memcpy, llvm.memmove and llvm.memset intrinsics, that are expanded or vectorized by the backend
+        size.value = LLVMBuildIntCast2(generator->builder, size.value, LLVMInt64TypeInContext(generator->context), !((TypeBasic*)size.type)->isUnsigned(), "mem_size");
+
+        if(this->name == "memset") {
+            if(!instanceof<TypeBasic>(source.type) || ((TypeBasic*)source.type)->isFloat()) generator->error("the value must have the integer type!", this->loc);
+            source.value = LLVMBuildIntCast2(generator->builder, source.value, LLVMInt8TypeInContext(generator->context), false, "mem_value");
+            LLVMBuildMemSet(generator->builder, dest.value, source.value, size.value, 1);
+        }
+        else {
+            if(!instanceof<TypePointer>(source.type)) generator->error("the second argument must be a pointer!", this->loc);
+            if(this->name == "memcpy") LLVMBuildMemCpy(generator->builder, dest.value, 1, source.value, 1, size.value);
+            else LLVMBuildMemMove(generator->builder, dest.value, 1, source.value, 1, size.value);
+        }
+
+        return {};
+    }
     else if(this->name == "alloca") {
         if(this->args.size() < 1) generator->error("at least one argument is required!", this->loc);
         RaveValue size = this->args[0]->generate();
 
         return (
             new NodeCast(
-                new TypePointer(basicTypes[BasicType::Char]),
+                getPointerType(basicTypes[BasicType::Char]),
                 new NodeDone(LLVM::alloc(size, "NodeBuiltin_alloca")),
                 this->loc
             )
@@ -769,7 +846,7 @@ RaveValue NodeBuiltin::generate() {
                 case BasicType::Int: return {LLVM::makeInt(64, 2147483647, false), basicTypes[BasicType::Long]};
                 case BasicType::Uint: return {LLVM::makeInt(64, 4294967295, false), basicTypes[BasicType::Long]};
                 case BasicType::Long: return {LLVM::makeInt(64, 9223372036854775807, false), basicTypes[BasicType::Long]};
-                case BasicType::Ulong: return {LLVM::makeInt(64, 18446744073709551615ull, false), new TypeBasic(BasicType::Ulong)};
+                case BasicType::Ulong: return {LLVM::makeInt(64, 18446744073709551615ull, false), basicTypes[BasicType::Ulong]};
                 // TODO: Add BasicType::Cent and BasicType::Ucent
                 default: return {LLVM::makeInt(64, 0, false), basicTypes[BasicType::Long]};
             }
@@ -796,7 +873,7 @@ Node* NodeBuiltin::comptime() {
         return nullptr;
     }
     else if(this->name == "sizeOf") return new NodeInt((asType(0)->type->getSize()) / 8);
-    else if(this->name == "tEquals") return new NodeBool(asType(0)->type->toString() == asType(1)->type->toString());
+    else if(this->name == "tEquals") return new NodeBool(isSameType(asType(0)->type, asType(1)->type));
     else if(this->name == "isStructure") return new NodeBool(instanceof<TypeStruct>(asType(0)->type));
     else if(this->name == "isNumeric") return new NodeBool(instanceof<TypeBasic>(asType(0)->type));
     else if(this->name == "isUnsigned") {
@@ -804,6 +881,11 @@ Node* NodeBuiltin::comptime() {
         if(!instanceof<TypeBasic>(_type)) return new NodeBool(false);
         return new NodeBool(((TypeBasic*)_type)->isUnsigned());
     }
+    else if(this->name == "isFloat") {
+        Type* _type = asType(0)->type;
+        if(!instanceof<TypeBasic>(_type)) return new NodeBool(false);
+        return new NodeBool(((TypeBasic*)_type)->isFloat());
+    }
     else if(this->name == "argsLength") return new NodeInt(AST::funcTable[currScope->funcName]->args.size());
     else if(this->name == "typeToString") return new NodeString(this->asType(0)->type->toString(), false);
     else if(this->name == "baseType") {
@@ -25,6 +25,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/llvm.hpp"
 
 NodeCall::NodeCall(int loc, Node* func, std::vector<Node*> args) {
+    this->kind = Kind;
     this->loc = loc;
     this->func = func;
     this->args = std::vector<Node*>(args);
@@ -44,7 +45,7 @@ bool hasIdenticallyArgs(std::vector<Type*> one, std::vector<Type*> two) {
 
     for(int i=0; i<one.size(); i++) {
         if(instanceof<TypeBasic>(one[i]) && instanceof<TypeBasic>(two[i])) {
-            if(one[i]->toString() != two[i]->toString()) {
+            if(!isSameType(one[i], two[i])) {
                 if(!isFloatType(one[i]) && !isFloatType(two[i])) {
                     if(
                         (((TypeBasic*)one[i])->type + 10 != ((TypeBasic*)two[i])->type) &&
@@ -54,7 +55,7 @@ bool hasIdenticallyArgs(std::vector<Type*> one, std::vector<Type*> two) {
             }
         }
 
-        if(one[i]->toString() != two[i]->toString()) return false;
+        if(!isSameType(one[i], two[i])) return false;
     }
     return true;
 }
@@ -64,7 +65,7 @@ bool hasIdenticallyArgs(std::vector<Type*> one, std::vector<FuncArgSet> two) {
 
     for(int i=0; i<one.size(); i++) {
         if(instanceof<TypeBasic>(one[i]) && instanceof<TypeBasic>(two[i].type)) {
-            if(one[i]->toString() != two[i].type->toString()) {
+            if(!isSameType(one[i], two[i].type)) {
                 if(!isFloatType(one[i]) && !isFloatType(two[i].type)) {
                     if(
                         (((TypeBasic*)one[i])->type + 10 != ((TypeBasic*)two[i].type)->type) &&
@@ -74,7 +75,7 @@ bool hasIdenticallyArgs(std::vector<Type*> one, std::vector<FuncArgSet> two) {
                 else return false;
             }
         }
-        else if(one[i] == nullptr || two[i].type == nullptr || one[i]->toString() != two[i].type->toString()) {
+        else if(one[i] == nullptr || two[i].type == nullptr || !isSameType(one[i], two[i].type)) {
             if(one[i] != nullptr && two[i].type != nullptr) {
                 while(instanceof<TypeConst>(one[i])) one[i] = one[i]->getElType();
                 while(instanceof<TypeConst>(two[i].type)) two[i].type = two[i].type->getElType();
@@ -107,7 +108,7 @@ Type* NodeCall::__getType(Node* _fn) {
         NodeIden* niden = (NodeIden*)_fn;
 
         if(AST::aliasTable.find(niden->name) != AST::aliasTable.end()) return __getType(AST::aliasTable[niden->name]);
-        else if(currScope != nullptr && currScope->aliasTable.find(niden->name) != currScope->aliasTable.end()) return __getType(currScope->aliasTable[niden->name]);
+        else if(currScope != nullptr && currScope->getAlias(niden->name) != nullptr) return __getType(currScope->getAlias(niden->name));
 
         std::vector<Type*> types = Call::getTypes(args);
 
@@ -122,7 +123,7 @@ Type* NodeCall::__getType(Node* _fn) {
             TypeFunc* fn = (TypeFunc*)currScope->getVar(niden->name, this->loc)->type;
             return fn->main;
         }
-        return new TypePointer(typeVoid);
+        return getPointerType(typeVoid);
     }
 
     return _fn->getType();
@@ -178,7 +179,7 @@ std::vector<RaveValue> Call::genParameters(std::vector<Node*>& arguments, std::v
     for(int i=0; i<params.size(); i++) {
         if(instanceof<TypePointer>(fas[i].type)) {
             if(instanceof<TypeStruct>(fas[i].type->getElType()) && !instanceof<TypePointer>(params[i].type)) LLVM::makeAsPointer(params[i]);
-            else if(isBytePointer(fas[i].type) && fas[i].type->toString() != params[i].type->toString()) LLVM::cast(params[i], new TypePointer(basicTypes[BasicType::Char]));
+            else if(isBytePointer(fas[i].type) && !isSameType(fas[i].type, params[i].type)) LLVM::cast(params[i], getPointerType(basicTypes[BasicType::Char]));
         }
         else {
             while(instanceof<TypePointer>(params[i].type)) {
@@ -235,7 +236,7 @@ std::string Template::fromTypes(std::vector<Type*>& types) {
     return sTypes;
 }
 
-std::map<std::pair<std::string, std::string>, NodeFunc*>::iterator Call::findMethod(std::string structName, std::string methodName, std::vector<Node*>& arguments, int loc) {
+SymbolTable<std::pair<std::string, std::string>, NodeFunc*>::iterator Call::findMethod(std::string structName, std::string methodName, std::vector<Node*>& arguments, int loc) {
     auto method = std::pair<std::string, std::string>(structName, methodName);
     auto methodf = AST::methodTable.find(method);
 
@@ -245,15 +246,12 @@ std::map<std::pair<std::string, std::string>, NodeFunc*>::iterator Call::findMet
 
     if(methodf == AST::methodTable.end() || methodf->second->args.size() != arguments.size()) {
         // Choose the most right overload
-        for(auto& it : AST::methodTable) {
-            if(it.first.first != structName || it.second->args.size() != arguments.size()) continue;
+        for(auto& name : AST::getMethodOverloads(structName, methodName)) {
+            auto it = AST::methodTable.find({structName, name});
+            if(it == AST::methodTable.end() || it->second->args.size() != arguments.size()) continue;
 
-            if(it.first.second != methodName) {
-                if(it.first.second.find(methodName + "[") != 0 && it.first.second.find(methodName + "<") != 0) continue;
-            }
-
-            method.second = it.first.second;
-            methodf = AST::methodTable.find(method);
+            method.second = name;
+            methodf = it;
             break;
         }
     }
@@ -272,7 +270,7 @@ RaveValue Call::make(int loc, Node* function, std::vector<Node*> arguments) {
         std::string& ifName = ((NodeIden*)function)->name;
 
         if(AST::aliasTable.find(ifName) != AST::aliasTable.end()) return Call::make(loc, AST::aliasTable[ifName], arguments);
-        else if(currScope != nullptr && currScope->aliasTable.find(ifName) != currScope->aliasTable.end()) return Call::make(loc, currScope->aliasTable[ifName], arguments);
+        else if(currScope != nullptr && currScope->getAlias(ifName) != nullptr) return Call::make(loc, currScope->getAlias(ifName), arguments);
 
         if(AST::funcTable.find(ifName) != AST::funcTable.end()) {
             checkAndGenerate(ifName);
@@ -313,6 +311,9 @@ RaveValue Call::make(int loc, Node* function, std::vector<Node*> arguments) {
                     // If types of parameters more than template types - remove last types
                     while(types.size() > tnSize) types.pop_back();
 
+                    // Inside of another template the parameters can have its template types
+                    for(size_t i=0; i<types.size(); i++) types[i] = generator->setByTypeList(getTrueTypeList(types[i]->copy()));
+
                     sTypes = Template::fromTypes(types);
 
                     if(types.size() == tnSize)
@@ -355,30 +356,25 @@ RaveValue Call::make(int loc, Node* function, std::vector<Node*> arguments) {
                     }
 
                     if(!hasIdenticallyArgs(types, AST::funcTable[ifName]->args)) {
-                        for(auto& it : AST::funcTable) {
-                            if(it.first != ifName) {
-                                if(it.first.find(ifName + "[") != 0 && it.first.find(ifName + "<") != 0) continue;
-                            }
+                        for(auto& name : AST::getOverloads(ifName)) {
+                            NodeFunc* func = AST::funcTable[name];
 
-                            if(hasIdenticallyArgs(types, it.second->args)) {
-                                checkAndGenerate(it.first);
-                                std::vector<RaveValue> params = Call::genParameters(arguments, byVals, it.second, loc);
-                                return LLVM::call(generator->functions[it.first], params, (instanceof<TypeVoid>(it.second->type) ? "" : "callFunc"), byVals);
+                            if(hasIdenticallyArgs(types, func->args)) {
+                                checkAndGenerate(name);
+                                std::vector<RaveValue> params = Call::genParameters(arguments, byVals, func, loc);
+                                return LLVM::call(generator->functions[name], params, (instanceof<TypeVoid>(func->type) ? "" : "callFunc"), byVals);
                             }
                         }
 
                         if(AST::funcTable[ifName]->args.size() != arguments.size()) {
                             // Choose the most right overload
-                            for(auto& it : AST::funcTable) {
-                                if(it.second->args.size() != arguments.size()) continue;
-
-                                if(it.first != ifName) {
-                                    if(it.first.find(ifName + "[") != 0 && it.first.find(ifName + "<") != 0) continue;
-                                }
+                            for(auto& name : AST::getOverloads(ifName)) {
+                                NodeFunc* func = AST::funcTable[name];
+                                if(func->args.size() != arguments.size()) continue;
 
-                                checkAndGenerate(it.first);
-                                std::vector<RaveValue> params = Call::genParameters(arguments, byVals, it.second, loc);
-                                return LLVM::call(generator->functions[it.first], params, (instanceof<TypeVoid>(it.second->type) ? "" : "callFunc"), byVals);
+                                checkAndGenerate(name);
+                                std::vector<RaveValue> params = Call::genParameters(arguments, byVals, func, loc);
+                                return LLVM::call(generator->functions[name], params, (instanceof<TypeVoid>(func->type) ? "" : "callFunc"), byVals);
                             }
                         }
 
@@ -391,15 +387,13 @@ RaveValue Call::make(int loc, Node* function, std::vector<Node*> arguments) {
                 }
                 else if(!hasIdenticallyArgs(types, AST::funcTable[ifName]->args)) {
                     // Choose the most right overload
-                    for(auto& it : AST::funcTable) {
-                        if(it.first != ifName) {
-                            if(it.first.find(ifName + "[") != 0 && it.first.find(ifName + "<") != 0) continue;
-                        }
+                    for(auto& name : AST::getOverloads(ifName)) {
+                        NodeFunc* func = AST::funcTable[name];
 
-                        if(hasIdenticallyArgs(types, it.second->args)) {
-                            checkAndGenerate(it.first);
-                            std::vector<RaveValue> params = Call::genParameters(arguments, byVals, it.second, loc);
-                            return LLVM::call(generator->functions[it.first], params, (instanceof<TypeVoid>(it.second->type) ? "" : "callFunc"), byVals);
+                        if(hasIdenticallyArgs(types, func->args)) {
+                            checkAndGenerate(name);
+                            std::vector<RaveValue> params = Call::genParameters(arguments, byVals, func, loc);
+                            return LLVM::call(generator->functions[name], params, (instanceof<TypeVoid>(func->type) ? "" : "callFunc"), byVals);
                         }
                     }
                 }
@@ -496,6 +490,9 @@ RaveValue Call::make(int loc, Node* function, std::vector<Node*> arguments) {
 
                 if(AST::funcTable.find(mainName + sTypes) != AST::funcTable.end()) return Call::make(loc, new NodeIden(mainName + sTypes, loc), arguments);
                 AST::funcTable[mainName]->generateWithTemplate(types, mainName + sTypes + (mainName.find('[') == std::string::npos ? callTypes : ""));
+
+                // The name can contain the template types of the current function, so the generated one is called by its resolved name
+                if(mainName.find('[') == std::string::npos) return Call::make(loc, new NodeIden(mainName + sTypes, loc), arguments);
             }
             else {
                 sTypes = "<";
@@ -533,13 +530,21 @@ RaveValue Call::make(int loc, Node* function, std::vector<Node*> arguments) {
                 std::vector<Type*> types = Call::getTypes(arguments);
 
                 if(!hasIdenticallyArgs(types, methodf->second->args)) {
+                    // funcTable is not ordered, so the match with the least name is taken, as in the order of names
+                    NodeFunc* func = nullptr;
+                    std::string funcKey;
                     for(auto& it : AST::funcTable) {
-                        if(hasIdenticallyArgs(types, it.second->args)) {
-                            if(generator->functions.find(it.second->name) == generator->functions.end()) it.second->generate();
-                            std::vector<RaveValue> params = Call::genParameters(arguments, byVals, it.second, loc);
-                            return LLVM::call(generator->functions[it.second->name], params, (instanceof<TypeVoid>(it.second->type) ? "" : "callFunc"), byVals);
+                        if(hasIdenticallyArgs(types, it.second->args) && (func == nullptr || it.first < funcKey)) {
+                            func = it.second;
+                            funcKey = it.first;
                         }
                     }
+
+                    if(func != nullptr) {
+                        if(generator->functions.find(func->name) == generator->functions.end()) func->generate();
+                        std::vector<RaveValue> params = Call::genParameters(arguments, byVals, func, loc);
+                        return LLVM::call(generator->functions[func->name], params, (instanceof<TypeVoid>(func->type) ? "" : "callFunc"), byVals);
+                    }
                 }
 
                 std::vector<RaveValue> params = Call::genParameters(arguments, byVals, methodf->second, loc);
@@ -654,4 +659,8 @@ RaveValue NodeCall::generate() {
 
 void NodeCall::check() {this->isChecked = true;}
 Node* NodeCall::comptime() {return this;}
-Node* NodeCall::copy() {return new NodeCall(this->loc, this->func, this->args);}
\ No newline at end of file
+Node* NodeCall::copy() {
+    std::vector<Node*> cArgs;
+    for(int i=0; i<this->args.size(); i++) cArgs.push_back(this->args[i]->copy());
+    return new NodeCall(this->loc, this->func->copy(), cArgs);
+}
\ No newline at end of file
@@ -17,6 +17,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include <iostream>
 
 NodeCast::NodeCast(Type* type, Node* value, int loc) {
+    this->kind = Kind;
     this->type = type;
     this->value = value;
     this->loc = loc;
@@ -11,6 +11,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include <iostream>
 
 NodeChar::NodeChar(std::string value, bool isWide) {
+    this->kind = Kind;
     this->value = value;
     this->isWide = isWide;
 }
@@ -15,6 +15,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/ast.hpp"
 
 NodeComptime::NodeComptime(Node* node) {
+    this->kind = Kind;
     this->node = node;
 }
 
@@ -16,6 +16,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/lexer/lexer.hpp"
 
 NodeConstStruct::NodeConstStruct(std::string name, std::vector<Node*> values, int loc) {
+    this->kind = Kind;
     this->structName = name;
     this->values = values;
     this->loc = loc;
@@ -27,7 +28,11 @@ NodeConstStruct::~NodeConstStruct() {
 
 Type* NodeConstStruct::getType() {return new TypeStruct(structName);}
 Node* NodeConstStruct::comptime() {return this;}
-Node* NodeConstStruct::copy() {return new NodeConstStruct(this->structName, this->values, this->loc);}
+Node* NodeConstStruct::copy() {
+    std::vector<Node*> cValues;
+    for(int i=0; i<this->values.size(); i++) cValues.push_back(this->values[i]->copy());
+    return new NodeConstStruct(this->structName, cValues, this->loc);
+}
 void NodeConstStruct::check() {this->isChecked = true;}
 
 RaveValue NodeConstStruct::generate() {
@@ -77,7 +82,7 @@ RaveValue NodeConstStruct::generate() {
     if(isConst) {
         std::vector<LLVMValueRef> __data;
         for(int i=0; i<llvmValues.size(); i++) {
-            if(variables[i]->getType()->toString() != llvmValues[i].type->toString()) {
+            if(!isSameType(variables[i]->getType(), llvmValues[i].type)) {
                 Type* varType = variables[i]->getType();
 
                 if(instanceof<TypeBasic>(varType) && instanceof<TypeBasic>(llvmValues[i].type)) LLVM::cast(llvmValues[i], varType, loc);
@@ -94,7 +99,7 @@ RaveValue NodeConstStruct::generate() {
         RaveValue temp = LLVM::alloc(new TypeStruct(this->structName), "constStruct_temp");
 
         for(int i=0; i<this->values.size(); i++) {
-            if(variables[i]->getType()->toString() != llvmValues[i].type->toString()) {
+            if(!isSameType(variables[i]->getType(), llvmValues[i].type)) {
                 Type* varType = variables[i]->getType();
 
                 if(instanceof<TypeBasic>(varType) && instanceof<TypeBasic>(llvmValues[i].type)) LLVM::cast(llvmValues[i], varType, loc);
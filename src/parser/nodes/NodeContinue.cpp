@@ -10,7 +10,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/nodes/NodeRet.hpp"
 #include <string>
 
-NodeContinue::NodeContinue(int loc) {this->loc = loc;}
+NodeContinue::NodeContinue(int loc) {this->kind = Kind; this->loc = loc;}
 void NodeContinue::check() {this->isChecked = true;}
 Type* NodeContinue::getType() {return typeVoid;}
 Node* NodeContinue::comptime() {return this;}
@@ -9,6 +9,7 @@ with this file, You can obtain one at htypep://mozilla.org/MPL/2.0/.
 #include "../../include/parser/nodes/NodeRet.hpp"
 
 NodeDefer::NodeDefer(Node* instruction, int loc, bool isFunctionScope) {
+    this->kind = Kind;
     this->instruction = instruction;
     this->loc = loc;
     this->isFunctionScope = isFunctionScope;
@@ -34,15 +35,13 @@ RaveValue NodeDefer::generate() {
 
             LLVM::Builder::atEnd(loop.end);
 
-            auto oldScope = currScope;
-            currScope = copyScope(oldScope);
+            currScope->push();
 
             instruction->generate();
 
             LLVM::Builder::atEnd(oldBB);
 
-            delete currScope;
-            currScope = oldScope;
+            currScope->pop();
             return {};
         }
     }
@@ -51,14 +50,12 @@ RaveValue NodeDefer::generate() {
         LLVMBasicBlockRef oldBB = generator->currBB;
         LLVM::Builder::atEnd(currScope->fnEnd);
 
-        auto oldScope = currScope;
-        currScope = copyScope(oldScope);
+        currScope->push();
 
         instruction->generate();
 
         LLVM::Builder::atEnd(oldBB);
-        delete currScope;
-        currScope = oldScope;
+        currScope->pop();
     }
 
     return {};
@@ -10,11 +10,11 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include <limits>
 #include <iostream>
 
-NodeFloat::NodeFloat(double value) {this->value = std::to_string(value);}
-NodeFloat::NodeFloat(std::string value) {this->value = value;}
-NodeFloat::NodeFloat(double value, bool isDouble) {if(isDouble) this->type = basicTypes[BasicType::Double]; this->value = std::to_string(value);}
-NodeFloat::NodeFloat(double value, TypeBasic* type) {this->value = std::to_string(value); this->type = type;}
-NodeFloat::NodeFloat(std::string value, TypeBasic* type) {this->value = value; this->type = type;}
+NodeFloat::NodeFloat(double value) {this->kind = Kind; this->value = std::to_string(value);}
+NodeFloat::NodeFloat(std::string value) {this->kind = Kind; this->value = value;}
+NodeFloat::NodeFloat(double value, bool isDouble) {this->kind = Kind; if(isDouble) this->type = basicTypes[BasicType::Double]; this->value = std::to_string(value);}
+NodeFloat::NodeFloat(double value, TypeBasic* type) {this->kind = Kind; this->value = std::to_string(value); this->type = type;}
+NodeFloat::NodeFloat(std::string value, TypeBasic* type) {this->kind = Kind; this->value = value; this->type = type;}
 
 Type* NodeFloat::getType() {
     if(this->type != nullptr) return this->type;
@@ -26,7 +26,7 @@ Type* NodeFloat::getType() {
 
     R128 r128;
     r128FromString(&r128, this->value.c_str(), nullptr);
-    this->type = new TypeBasic((r128 > R128(std::numeric_limits<float>::max())) ? BasicType::Double : (BasicType::Float));
+    this->type = basicTypes[(r128 > R128(std::numeric_limits<float>::max())) ? BasicType::Double : BasicType::Float];
 
     return this->type;
 }
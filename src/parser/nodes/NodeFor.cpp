@@ -18,6 +18,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include <iostream>
 
 NodeFor::NodeFor(std::vector<Node*> presets, Node* cond, std::vector<Node*> afters, NodeBlock* block, int loc) {
+    this->kind = Kind;
     this->presets = std::vector<Node*>(presets);
     this->cond = cond;
     this->afters = std::vector<Node*>(afters);
@@ -37,7 +38,7 @@ Node* NodeFor::copy() {
     std::vector<Node*> afters;
     for(int i=0; i<this->presets.size(); i++) presets.push_back(this->presets[i]->copy());
     for(int i=0; i<this->afters.size(); i++) afters.push_back(this->afters[i]->copy());
-    return new NodeFor(presets, (NodeBinary*)(this->cond->copy()), this->afters, (NodeBlock*)(this->block->copy()), this->loc);
+    return new NodeFor(presets, (NodeBinary*)(this->cond->copy()), afters, (NodeBlock*)(this->block->copy()), this->loc);
 }
 
 Node* NodeFor::comptime() {return this;}
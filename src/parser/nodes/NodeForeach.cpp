@@ -22,6 +22,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include <iostream>
 
 NodeForeach::NodeForeach(NodeIden* elName, Node* varData, Node* varLength, NodeBlock* block, int loc) {
+    this->kind = Kind;
     this->elName = elName;
     this->varData = varData;
     this->varLength = varLength;
@@ -34,6 +34,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include <llvm-c/Analysis.h>
 #include "../../include/compiler.hpp"
 #include "../../include/llvm.hpp"
+#include "../../include/timetrace.hpp"
 
 Type* getTypeBySize(int size) {
     if(size == 8) return basicTypes[BasicType::Char];
@@ -44,6 +45,7 @@ Type* getTypeBySize(int size) {
 }
 
 NodeFunc::NodeFunc(const std::string& name, std::vector<FuncArgSet> args, NodeBlock* block, bool isExtern, std::vector<DeclarMod> mods, int loc, Type* type, std::vector<std::string> templateNames) {
+    this->kind = Kind;
     this->name = name;
     this->origName = name;
     this->args = std::vector<FuncArgSet>(args);
@@ -130,6 +132,7 @@ void NodeFunc::check() {
         }
 
         AST::funcTable[this->name] = this;
+        AST::addOverload(this->name);
         for(int i=0; i<this->block->nodes.size(); i++) {
             this->block->nodes[i]->check();
         }
@@ -250,11 +253,22 @@ RaveValue NodeFunc::generate() {
         else if(this->mods[i].name == "noOptimize") this->isNoOpt = true;
         else if(this->mods[i].name == "arrayable") this->isArrayable = true;
         else if(this->mods[i].name == "conditions") conditions = (NodeArray*)this->mods[i].value;
+        else if(this->mods[i].name == "target_clones") {
+            if(!instanceof<NodeArray>(this->mods[i].value)) generator->error("value type of 'target_clones' must be an array of strings!", loc);
+            this->targetClones.clear();
+
+            for(Node* node : ((NodeArray*)this->mods[i].value)->values) {
+                Node* target = node->comptime();
+                if(!instanceof<NodeString>(target)) generator->error("value type of 'target_clones' must be an array of strings!", loc);
+                if(!LLVM::isCloneTarget(((NodeString*)target)->value)) generator->error("unknown target '" + ((NodeString*)target)->value + "' in 'target_clones'!", loc);
+                this->targetClones.push_back(((NodeString*)target)->value);
+            }
+        }
     }
 
     if(!this->isTemplate && this->isCtargs) return {};
 
-    std::map<std::string, Type*> oldReplace = std::map<std::string, Type*>(generator->toReplace);
+    SymbolTable<std::string, Type*> oldReplace = generator->toReplace;
     if(this->isTemplate) {
         generator->toReplace.clear();
         for(int i=0; i<this->templateNames.size(); i++) generator->toReplace[this->templateNames[i]] = this->templateTypes[i];
@@ -338,7 +352,10 @@ RaveValue NodeFunc::generate() {
     tfunc->main = this->type;
 
     LLVMValueRef fn = LLVMGetNamedFunction(generator->lModule, linkName.c_str());
-    if(fn != nullptr) return {};
+    if(fn != nullptr) {
+        if(this->isTemplate) generator->toReplace = oldReplace;
+        return {};
+    }
 
     generator->functions[this->name] = {LLVMAddFunction(
         generator->lModule, linkName.c_str(),
@@ -368,15 +385,25 @@ RaveValue NodeFunc::generate() {
         generator->addAttr("optnone", LLVMAttributeFunctionIndex, generator->functions[this->name].value, this->loc);
     }
 
-    if(this->isTemplatePart || this->isTemplate || this->isCtargsPart || this->isComdat) {
+    bool isInstance = this->isTemplatePart || this->isTemplate || this->isCtargsPart;
+
+    if(isInstance && Compiler::settings.lto && Compiler::emittedTemplates.count(linkName) > 0) {
+        // All modules are linked before the optimization, so the instance that was emitted by one of the previous jobs is only declared
+        LLVMSetLinkage(generator->functions[this->name].value, LLVMExternalLinkage);
+        this->isExtern = true;
+    }
+    else if(isInstance || this->isComdat) {
         LLVMComdatRef comdat = LLVMGetOrInsertComdat(generator->lModule, linkName.c_str());
         LLVMSetComdatSelectionKind(comdat, LLVMAnyComdatSelectionKind);
         LLVMSetComdat(generator->functions[this->name].value, comdat);
         LLVMSetLinkage(generator->functions[this->name].value, LLVMLinkOnceODRLinkage);
         this->isExtern = false;
+
+        if(isInstance && Compiler::settings.lto && Compiler::currentJob != nullptr) Compiler::currentJob->templates.push_back(linkName);
     }
 
     if(!this->isExtern) {
+        TimeTrace::Scope traceScope("Function", this->name);
         int oldCurrentBuiltinArg = generator->currentBuiltinArg;
         if(this->isCtargsPart || this->isCtargs) generator->currentBuiltinArg = 0;
 
@@ -441,9 +468,13 @@ RaveValue NodeFunc::generate() {
         generator->currBB = oldCurrBB;
 
         generator->currentBuiltinArg = oldCurrentBuiltinArg;
+
+        // The variants are cloned after the whole module is generated; without ifuncs only the default variant is compiled
+        if(!this->targetClones.empty() && (Compiler::ravePlatform == "X86_64" || Compiler::ravePlatform == "X86") && (Compiler::raveOs == "LINUX" || Compiler::raveOs == "FREEBSD"))
+            generator->targetClones.push_back({generator->functions[this->name].value, this->targetClones});
     }
 
-    if(this->isTemplate) generator->toReplace = std::map<std::string, Type*>(oldReplace);
+    if(this->isTemplate) generator->toReplace = oldReplace;
 
     if(LLVMVerifyFunction(generator->functions[this->name].value, LLVMPrintMessageAction)) {
         std::string content = LLVMPrintValueToString(generator->functions[this->name].value);
@@ -455,6 +486,7 @@ RaveValue NodeFunc::generate() {
 }
 
 std::string NodeFunc::generateWithCtargs(std::vector<Type*> args) {
+    TimeTrace::Scope traceScope("Template", this->name);
     std::vector<FuncArgSet> newArgs;
     for(int i=0; i<args.size(); i++) {
         Type* newType = args[i];
@@ -487,6 +519,7 @@ std::string NodeFunc::generateWithCtargs(std::vector<Type*> args) {
 }
 
 RaveValue NodeFunc::generateWithTemplate(std::vector<Type*>& types, const std::string& all) {
+    TimeTrace::Scope traceScope("Template", all);
     auto activeLoops = std::map<int32_t, Loop>(generator->activeLoops);
     auto builder = generator->builder;
     auto currBB = generator->currBB;
@@ -509,7 +542,20 @@ RaveValue NodeFunc::generateWithTemplate(std::vector<Type*>& types, const std::s
 Node* NodeFunc::comptime() {return this;}
 Type* NodeFunc::getType() {return this->type;}
 
-Node* NodeFunc::copy() {return new NodeFunc(this->name, this->args, (NodeBlock*)this->block->copy(), this->isExtern, this->mods, this->loc, this->type->copy(), this->templateNames);}
+Node* NodeFunc::copy() {
+    // The internal types, that are the argument type itself, stay the same object in the copy
+    std::vector<FuncArgSet> cArgs = this->args;
+    for(int i=0; i<cArgs.size(); i++) {
+        if(cArgs[i].type != nullptr) cArgs[i].type = this->args[i].type->copy();
+        for(int j=0; j<cArgs[i].internalTypes.size(); j++) {
+            Type* internal = this->args[i].internalTypes[j];
+            if(internal == this->args[i].type) cArgs[i].internalTypes[j] = cArgs[i].type;
+            else if(internal != nullptr) cArgs[i].internalTypes[j] = internal->copy();
+        }
+    }
+
+    return new NodeFunc(this->name, cArgs, (NodeBlock*)this->block->copy(), this->isExtern, this->mods, this->loc, this->type->copy(), this->templateNames);
+}
 
 Type* NodeFunc::getInternalArgType(LLVMValueRef value) {
     std::string __n = LLVMPrintValueToString(value);
@@ -17,6 +17,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include <string>
 
 NodeGet::NodeGet(Node* base, std::string field, bool isMustBePtr, int loc) {
+    this->kind = Kind;
     this->base = base;
     this->field = field;
     this->isMustBePtr = isMustBePtr;
@@ -78,7 +79,7 @@ Type* NodeGet::getType() {
 
 RaveValue NodeGet::checkStructure(RaveValue ptr) {
     if(!instanceof<TypePointer>(ptr.type)) {
-        if(LLVMIsAArgument(ptr.value) && LLVMGetTypeKind(LLVMTypeOf(ptr.value)) == LLVMPointerTypeKind) ptr.type = new TypePointer(ptr.type);
+        if(LLVMIsAArgument(ptr.value) && LLVMGetTypeKind(LLVMTypeOf(ptr.value)) == LLVMPointerTypeKind) ptr.type = getPointerType(ptr.type);
         else {
             RaveValue temp = LLVM::alloc(ptr.type, "NodeGet_checkStructure");
             LLVMBuildStore(generator->builder, ptr.value, temp.value);
@@ -123,7 +124,7 @@ RaveValue NodeGet::generate() {
 
     if(instanceof<NodeIden>(this->base)) {
         NodeIden* niden = static_cast<NodeIden*>(this->base);
-        if(currScope->localVars.find(niden->name) != currScope->localVars.end()) currScope->localVars[niden->name]->isUsed = true;
+        currScope->markUsed(niden->name);
         ptr = checkStructure(currScope->getWithoutLoad(niden->name, loc));
         ty = ptr.type;
 
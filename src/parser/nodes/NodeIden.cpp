@@ -12,11 +12,13 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/ast.hpp"
 
 NodeIden::NodeIden(std::string name, int loc) {
+    this->kind = Kind;
     this->name = name;
     this->loc = loc;
 }
 
 NodeIden::NodeIden(std::string name, int loc, bool isMustBePtr) {
+    this->kind = Kind;
     this->name = name;
     this->loc = loc;
     this->isMustBePtr = isMustBePtr;
@@ -71,7 +73,7 @@ RaveValue NodeIden::generate() {
 
     if(currScope != nullptr) {
         if(currScope->has(this->name) || currScope->hasAtThis(this->name)) {
-            if(currScope->localVars.find(name) != currScope->localVars.end()) currScope->localVars[name]->isUsed = true;
+            currScope->markUsed(name);
 
             if(isMustBePtr) return currScope->getWithoutLoad(this->name, loc);
             return currScope->get(this->name, loc);
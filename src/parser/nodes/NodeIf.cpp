@@ -19,6 +19,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/utils.hpp"
 
 NodeIf::NodeIf(Node* cond, Node* body, Node* _else, int loc, bool isStatic) {
+    this->kind = Kind;
     this->cond = cond;
     this->body = body;
     this->_else = _else;
@@ -60,8 +61,6 @@ RaveValue NodeIf::generate() {
         currScope->elseIfEnd = nullptr;
     }
 
-    auto origScope = currScope;
-
     RaveValue condValue = cond->generate();
 
     if(isLikely || isUnlikely) {
@@ -83,7 +82,7 @@ RaveValue NodeIf::generate() {
 
     LLVM::Builder::atEnd(thenBlock);
 
-    currScope = copyScope(origScope);
+    currScope->push();
 
     if(this->body != nullptr) this->body->generate();
     if(!generator->activeLoops[selfNum].hasEnd) LLVMBuildBr(generator->builder, endBlock);
@@ -92,8 +91,8 @@ RaveValue NodeIf::generate() {
 
     generator->activeLoops[selfNum] = Loop{.isActive = true, .start = elseBlock, .end = endBlock, .hasEnd = false, .isIf = true, .loopRets = std::vector<LoopReturn>(), .owner = this};
 
-    delete currScope;
-    currScope = copyScope(origScope);
+    currScope->pop();
+    currScope->push();
 
     LLVM::Builder::atEnd(elseBlock);
     if(this->_else != nullptr) this->_else->generate();
@@ -102,7 +101,7 @@ RaveValue NodeIf::generate() {
 
     bool hasEnd2 = generator->activeLoops[selfNum].hasEnd;
 
-    currScope = origScope;
+    currScope->pop();
 
     LLVM::Builder::atEnd(endBlock);
     generator->activeLoops.erase(selfNum);
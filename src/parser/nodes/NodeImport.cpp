@@ -15,11 +15,14 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/utils.hpp"
 #include "../../include/parser/ast.hpp"
 #include "../../include/lexer/lexer.hpp"
+#include "../../include/lexer/source.hpp"
 #include "../../include/parser/parser.hpp"
 #include <algorithm>
 #include <fstream>
 #include <chrono>
 #include "../../include/compiler.hpp"
+#include "../../include/timetrace.hpp"
+#include "../../include/arena.hpp"
 
 #ifdef _WIN32
    #include <io.h> 
@@ -44,6 +47,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #endif
 
 NodeImport::NodeImport(ImportFile file, std::vector<std::string> functions, int loc) {
+    this->kind = Kind;
     this->file = file;
     this->functions = functions;
     this->loc = loc;
@@ -75,29 +79,43 @@ RaveValue NodeImport::generate() {
         return {};
     }
 
+    TimeTrace::Scope scope("Import", file.file);
+
     if(AST::parsed.find(file.file) == AST::parsed.end()) {
         if(!fs::exists(file.file)) {
             generator->error("file '" + file.file + "' does not exist!", this->loc);
             return {};
         }
 
-        std::ifstream fContent(file.file);
-        std::string content((std::istreambuf_iterator<char>(fContent)), std::istreambuf_iterator<char>());
-
-        content = "alias __RAVE_IMPORTED_FROM = \"" + generator->file + "\"; " + content;
+        SourceFile content(file.file);
 
+        // The alias is lexed separately, so the file itself is lexed straight from the mapped memory.
+        // The alias has no line breaks, so the line numbers of the file stay the same.
         auto start = std::chrono::steady_clock::now();
-        Lexer lexer(content, 1);
+        TimeTrace::Scope lexScope("Lex", file.file);
+        Lexer lexer("alias __RAVE_IMPORTED_FROM = \"" + generator->file + "\"; ", 1);
+        Lexer fileLexer(content.data, content.size, 1);
+        lexScope.end();
+
+        delete lexer.tokens.back();
+        lexer.tokens.pop_back();
+        lexer.tokens.insert(lexer.tokens.end(), fileLexer.tokens.begin(), fileLexer.tokens.end());
+        fileLexer.tokens.clear();
         auto end = std::chrono::steady_clock::now();
         Compiler::lexTime += std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 
         start = end;
-        Parser parser = Parser(lexer.tokens, file.file);
-        parser.parseAll();
+        TimeTrace::Scope parseScope("Parse", file.file);
+        {
+            // The parsed file is reused by all next files of the thread, so its nodes are not released with the compilation
+            Arena::Persistent persistent;
+            Parser parser = Parser(lexer.tokens, file.file);
+            parser.parseAll();
+            AST::parsed[file.file] = parser.nodes;
+        }
+        parseScope.end();
         end = std::chrono::steady_clock::now();
         Compiler::parseTime += std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-
-        AST::parsed[file.file] = parser.nodes;
     }
 
     std::vector<Node*> buffer;
@@ -108,6 +126,8 @@ RaveValue NodeImport::generate() {
         if(nodeVar->name == "__RAVE_IMPORTED_FROM") nodeVar->value = new NodeString(generator->file, false);
     }
 
+    TimeTrace::Scope checkScope("Check", file.file);
+
     for(auto* node : buffer) {
         if(instanceof<NodeFunc>(node)) {
             auto* nodeFunc = static_cast<NodeFunc*>(node);
@@ -122,9 +142,12 @@ RaveValue NodeImport::generate() {
         else node->check();
     }
 
+    checkScope.end();
+
     std::string oldFile = generator->file;
     generator->file = file.file;
     auto start = std::chrono::steady_clock::now();
+    TimeTrace::Scope generateScope("Generate", file.file);
 
     for(auto* node : buffer) {
         if(instanceof<NodeFunc>(node)) {
@@ -163,6 +186,7 @@ RaveValue NodeImport::generate() {
 }
 
 NodeImports::NodeImports(std::vector<NodeImport*> imports, int loc) {
+    this->kind = Kind;
     this->imports = std::vector<NodeImport*>(imports);
     this->loc = loc;
 }
@@ -25,7 +25,71 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/Types.hpp"
 #include "../../include/llvm.hpp"
 
+// Pointers to the stack and to the globals are never null, so they are not checked
+static bool isKnownNonNull(LLVMValueRef value) {
+    while(LLVMIsAGetElementPtrInst(value) || LLVMIsABitCastInst(value)) value = LLVMGetOperand(value, 0);
+    return LLVMIsAConstant(value) || LLVMIsAAllocaInst(value);
+}
+
+// Out-of-line failure of the runtime checks: cold and noreturn, so the checked code stays small and the checks of loop-invariant pointers are moved out of the loops
+static LLVMValueRef getCheckFailure(int loc) {
+    LLVMValueRef failure = LLVMGetNamedFunction(generator->lModule, "_RaveCheckFailed");
+    if(failure != nullptr) return failure;
+
+    if(generator->functions.find("std::putswnl") == generator->functions.end()) AST::funcTable["std::putswnl"]->generate();
+    if(generator->functions.find("std::exit") == generator->functions.end()) AST::funcTable["std::exit"]->generate();
+    LLVMValueRef putswnl = generator->functions["std::putswnl"].value;
+    LLVMValueRef exit = generator->functions["std::exit"].value;
+
+    LLVMTypeRef charPtr = LLVMPointerType(LLVMInt8TypeInContext(generator->context), 0);
+    failure = LLVMAddFunction(generator->lModule, "_RaveCheckFailed", LLVMFunctionType(LLVMVoidTypeInContext(generator->context), &charPtr, 1, false));
+    LLVMSetLinkage(failure, LLVMInternalLinkage);
+    generator->addAttr("cold", LLVMAttributeFunctionIndex, failure, loc);
+    generator->addAttr("noinline", LLVMAttributeFunctionIndex, failure, loc);
+    generator->addAttr("noreturn", LLVMAttributeFunctionIndex, failure, loc);
+    generator->addAttr("nounwind", LLVMAttributeFunctionIndex, failure, loc);
+
+    LLVMBuilderRef builder = LLVMCreateBuilderInContext(generator->context);
+    LLVMPositionBuilderAtEnd(builder, LLVMAppendBasicBlockInContext(generator->context, failure, "entry"));
+
+    LLVMValueRef message = LLVMGetParam(failure, 0);
+    LLVMValueRef code = LLVM::makeInt(32, 1, false);
+    LLVMBuildCall2(builder, LLVMGlobalGetValueType(putswnl), putswnl, &message, 1, "");
+    LLVMBuildCall2(builder, LLVMGlobalGetValueType(exit), exit, &code, 1, "");
+    LLVMBuildUnreachable(builder);
+
+    LLVMDisposeBuilder(builder);
+    return failure;
+}
+
+// Runtime check of the indexed pointer (until -O3 and without --noChecks): a branch to the failure, instead of an inlined std::assert
+static void checkNotNull(RaveValue ptr, int loc) {
+    if(generator->settings.noChecks || generator->settings.optLevel > 2) return;
+
+    auto func = AST::funcTable.find(currScope->funcName);
+    if(func != AST::funcTable.end() && func->second->isNoChecks) return;
+
+    // Checks need the prelude
+    if(AST::funcTable.find("std::putswnl") == AST::funcTable.end() || AST::funcTable.find("std::exit") == AST::funcTable.end()) return;
+    if(LLVMGetTypeKind(LLVMTypeOf(ptr.value)) != LLVMPointerTypeKind || isKnownNonNull(ptr.value)) return;
+
+    std::string message = "Assert in '" + generator->file + "' file in function '" + currScope->funcName + "' at " + std::to_string(loc) + " line: trying to get a value from a null pointer!\n";
+
+    LLVMBasicBlockRef failed = LLVM::makeBlock("checkFailed", currScope->funcName);
+    LLVMBasicBlockRef checked = LLVM::makeBlock("checked", currScope->funcName);
+    LLVMBuildCondBr(generator->builder, LLVMBuildIsNull(generator->builder, ptr.value, "isNull"), failed, checked);
+
+    LLVM::Builder::atEnd(failed);
+    LLVMValueRef failure = getCheckFailure(loc);
+    LLVMValueRef text = LLVMBuildGlobalStringPtr(generator->builder, message.c_str(), "_str");
+    LLVMBuildCall2(generator->builder, LLVMGlobalGetValueType(failure), failure, &text, 1, "");
+    LLVMBuildUnreachable(generator->builder);
+
+    LLVM::Builder::atEnd(checked);
+}
+
 NodeIndex::NodeIndex(Node* element, std::vector<Node*> indexes, int loc) {
+    this->kind = Kind;
     this->element = element;
     this->indexes = indexes;
     this->loc = loc;
@@ -68,7 +132,11 @@ void NodeIndex::check() {
     if(!oldCheck) this->element->check();
 }
 
-Node* NodeIndex::copy() {return new NodeIndex(this->element->copy(), this->indexes, this->loc);}
+Node* NodeIndex::copy() {
+    std::vector<Node*> cIndexes;
+    for(int i=0; i<this->indexes.size(); i++) cIndexes.push_back(this->indexes[i]->copy());
+    return new NodeIndex(this->element->copy(), cIndexes, this->loc);
+}
 Node* NodeIndex::comptime() {return this;}
 
 std::vector<LLVMValueRef> NodeIndex::generateIndexes() {
@@ -91,7 +159,7 @@ bool NodeIndex::isElementConst(Type* type) {
 RaveValue NodeIndex::generate() {
     if(instanceof<NodeIden>(this->element)) {
         NodeIden* id = (NodeIden*)this->element;
-        if(currScope->localVars.find(id->name) != currScope->localVars.end()) currScope->localVars[id->name]->isUsed = true;
+        currScope->markUsed(id->name);
         Type* _t = currScope->getVar(id->name, this->loc)->type;
 
         if(instanceof<TypeVector>(_t)) {
@@ -132,17 +200,7 @@ RaveValue NodeIndex::generate() {
         if(instanceof<TypeArray>(ptr.type) && instanceof<TypeArray>(currScope->getWithoutLoad(id->name, this->loc).type)) LLVM::makeAsPointer(ptr);
         else if(!instanceof<TypePointer>(ptr.type)) ptr = currScope->getWithoutLoad(id->name, this->loc);
 
-        if(!generator->settings.noChecks && generator->settings.optLevel <= 2 && !LLVMIsAConstant(ptr.value) &&
-            (AST::funcTable.find(currScope->funcName) == AST::funcTable.end() || !AST::funcTable[currScope->funcName]->isNoChecks)
-        ) {
-            auto assertFunc = AST::funcTable.find("std::assert[_b_pc]");
-            if(assertFunc != AST::funcTable.end()) {
-                (new NodeCall(loc, new NodeIden(assertFunc->second->name, this->loc), {
-                    new NodeBinary(TokType::Nequal, new NodeDone(ptr), new NodeNull(nullptr, loc), loc),
-                    new NodeString("Assert in '" + generator->file + "' file in function '" + currScope->funcName + "' at " + std::to_string(loc) + " line: trying to get a value from a null pointer!\n", false)
-                }))->generate();
-            }
-        }
+        checkNotNull(ptr, this->loc);
 
         RaveValue index = generator->byIndex(ptr, this->generateIndexes());
 
@@ -211,17 +269,7 @@ RaveValue NodeIndex::generate() {
         NodeCall* ncall = (NodeCall*)this->element;
         RaveValue vr = ncall->generate();
 
-        if(!generator->settings.noChecks && generator->settings.optLevel <= 2 &&
-            ((AST::funcTable.find(currScope->funcName) != AST::funcTable.end() && AST::funcTable[currScope->funcName]->isNoChecks == false)
-            || AST::funcTable.find(currScope->funcName) == AST::funcTable.end())
-        ) {
-            if(AST::funcTable.find("std::assert[_b_pc]") != AST::funcTable.end()) {
-                (new NodeCall(this->loc, new NodeIden("std::assert[_b_pc]", this->loc), {
-                    new NodeBinary(TokType::Nequal, new NodeDone(vr), new NodeNull(nullptr, this->loc), this->loc),
-                    new NodeString("Assert in '" + generator->file + "' file in function '" + currScope->funcName + "' at " + std::to_string(this->loc) + " line: trying to get a value from a null pointer!\n", false)
-                }))->generate();
-            }
-        }
+        checkNotNull(vr, this->loc);
 
         RaveValue index = generator->byIndex(vr, this->generateIndexes());
         if(isMustBePtr) return index;
@@ -245,17 +293,7 @@ RaveValue NodeIndex::generate() {
         NodeCast* ncast = (NodeCast*)this->element;
         RaveValue val = ncast->generate();
 
-        if(!generator->settings.noChecks && generator->settings.optLevel <= 2 &&
-            ((AST::funcTable.find(currScope->funcName) != AST::funcTable.end() && AST::funcTable[currScope->funcName]->isNoChecks == false)
-            || AST::funcTable.find(currScope->funcName) == AST::funcTable.end())
-        ) {
-            if(AST::funcTable.find("std::assert[_b_pc]") != AST::funcTable.end()) {
-                (new NodeCall(this->loc, new NodeIden("std::assert[_b_pc]", this->loc), {
-                    new NodeBinary(TokType::Nequal, new NodeDone(val), new NodeNull(nullptr, this->loc), this->loc),
-                    new NodeString("Assert in '" + generator->file + "' file in function '" + currScope->funcName + "' at " + std::to_string(this->loc) + " line: trying to get a value from a null pointer!\n", false)
-                }))->generate();
-            }
-        }
+        checkNotNull(val, this->loc);
 
         RaveValue index = generator->byIndex(val, this->generateIndexes());
         if(isMustBePtr) return index;
@@ -282,17 +320,7 @@ RaveValue NodeIndex::generate() {
 
         RaveValue val = nunary->generate();
 
-        if(!generator->settings.noChecks && generator->settings.optLevel <= 2 &&
-            ((AST::funcTable.find(currScope->funcName) != AST::funcTable.end() && AST::funcTable[currScope->funcName]->isNoChecks == false)
-            || AST::funcTable.find(currScope->funcName) == AST::funcTable.end())
-        ) {
-            if(AST::funcTable.find("std::assert[_b_pc]") != AST::funcTable.end()) {
-                (new NodeCall(this->loc, new NodeIden("std::assert[_b_pc]", this->loc), {
-                    new NodeBinary(TokType::Nequal, new NodeDone(val), new NodeNull(nullptr, this->loc), this->loc),
-                    new NodeString("Assert in '" + generator->file + "' file in function '" + currScope->funcName + "' at " + std::to_string(this->loc) + " line: trying to get a value from a null pointer!\n", false)
-                }))->generate();
-            }
-        }
+        checkNotNull(val, this->loc);
 
         RaveValue index = generator->byIndex(val, this->generateIndexes());
         return index;
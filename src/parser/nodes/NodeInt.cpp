@@ -9,11 +9,13 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/ast.hpp"
 
 NodeInt::NodeInt(BigInt value, unsigned char sys) {
+    this->kind = Kind;
     this->value = value;
     this->sys = sys;
 }
 
 NodeInt::NodeInt(BigInt value, char type, Type* isVarVal, unsigned char sys, bool isUnsigned, bool isMustBeLong) {
+    this->kind = Kind;
     this->value = value;
     this->type = type;
     this->sys = sys;
@@ -11,6 +11,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/ast.hpp"
 
 NodeItop::NodeItop(Node* value, Type* type, int loc) {
+    this->kind = Kind;
     this->value = value;
     this->type = type;
     this->loc = loc;
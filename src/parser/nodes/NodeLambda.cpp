@@ -9,6 +9,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/nodes/NodeFunc.hpp"
 
 NodeLambda::NodeLambda(int loc, TypeFunc* tf, NodeBlock* block, std::string name) {
+    this->kind = Kind;
     this->loc = loc;
     this->tf = tf;
     this->block = block;
@@ -13,6 +13,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include <string>
 
 NodeNamespace::NodeNamespace(std::string name, std::vector<Node*> nodes, int loc) {
+    this->kind = Kind;
     this->loc = loc;
     this->nodes = std::vector<Node*>(nodes);
     this->names = std::vector<std::string>();
@@ -20,6 +21,7 @@ NodeNamespace::NodeNamespace(std::string name, std::vector<Node*> nodes, int loc
 }
 
 NodeNamespace::NodeNamespace(std::vector<std::string> names, std::vector<Node*> nodes, int loc) {
+    this->kind = Kind;
     this->loc = loc;
     this->nodes = std::vector<Node*>(nodes);
     this->names = std::vector<std::string>();
@@ -32,7 +34,7 @@ NodeNamespace::~NodeNamespace() {
 
 Node* NodeNamespace::copy() {
     std::vector<Node*> cNodes;
-    for(int i=0; i<this->nodes.size(); i++) cNodes.push_back(this->nodes[i]);
+    for(int i=0; i<this->nodes.size(); i++) cNodes.push_back(this->nodes[i]->copy());
     return new NodeNamespace(std::vector<std::string>(this->names), cNodes, this->loc);
 }
 
@@ -66,6 +68,7 @@ void NodeNamespace::check() {
             }
             else for(int i=0; i<this->names.size(); i++) nnamespace->names.insert(nnamespace->names.begin()+i, this->names[i]);
             nnamespace->isImported = (nnamespace->isImported || this->isImported);
+            nnamespace->hidePrivated = (nnamespace->hidePrivated || this->hidePrivated);
             this->nodes[i]->check();
         }
         else if(instanceof<NodeVar>(this->nodes[i])) {
@@ -117,6 +120,7 @@ RaveValue NodeNamespace::generate() {
                 this->nodes[i]->check();
             }
             nnamespace->isImported = (nnamespace->isImported || this->isImported);
+            nnamespace->hidePrivated = (nnamespace->hidePrivated || this->hidePrivated);
             nnamespace->generate();
         }
         else if(instanceof<NodeVar>(this->nodes[i])) {
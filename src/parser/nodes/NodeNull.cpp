@@ -10,17 +10,17 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/nodes/NodeCast.hpp"
 #include <iostream>
 
-NodeNull::NodeNull(Type* type, int loc) {this->type = type; this->loc = loc;}
-Type* NodeNull::getType() {return (this->type == nullptr ? new TypePointer(typeVoid) : this->type);}
+NodeNull::NodeNull(Type* type, int loc) {this->kind = Kind; this->type = type; this->loc = loc;}
+Type* NodeNull::getType() {return (this->type == nullptr ? getPointerType(typeVoid) : this->type);}
 
 RaveValue NodeNull::generate() {
     if(this->type != nullptr) return {LLVMConstNull(generator->genType(this->type, this->loc)), this->type};
-    return {LLVMConstNull(LLVMPointerType(LLVMInt8TypeInContext(generator->context), 0)), new TypePointer(typeVoid)};
+    return {LLVMConstNull(LLVMPointerType(LLVMInt8TypeInContext(generator->context), 0)), getPointerType(typeVoid)};
 }
 
 void NodeNull::check() {this->isChecked = true;}
 Node* NodeNull::comptime() {return this;}
-Node* NodeNull::copy() {return new NodeNull(this->type, this->loc);}
+Node* NodeNull::copy() {return new NodeNull((this->type == nullptr) ? nullptr : this->type->copy(), this->loc);}
 
 NodeNull::~NodeNull() {
     if(this->type != nullptr && !instanceof<TypeBasic>(this->type) && !instanceof<TypeVoid>(this->type)) delete this->type;
@@ -10,7 +10,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/nodes/NodePtoi.hpp"
 #include "../../include/parser/ast.hpp"
 
-NodePtoi::NodePtoi(Node* value, int loc) {this->value = value; this->loc = loc;}
+NodePtoi::NodePtoi(Node* value, int loc) {this->kind = Kind; this->value = value; this->loc = loc;}
 
 Type* NodePtoi::getType() {return basicTypes[BasicType::Long];}
 Node* NodePtoi::comptime() {return this;}
@@ -16,10 +16,11 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/nodes/NodeVar.hpp"
 
 namespace AST {
-    extern std::map<std::string, NodeFunc*> funcTable;
+    extern thread_local SymbolTable<std::string, NodeFunc*> funcTable;
 }
 
 NodeRet::NodeRet(Node* value, int loc) {
+    this->kind = Kind;
     this->value = (value == nullptr ? nullptr : value->copy());
     this->loc = loc;
 }
@@ -59,7 +60,7 @@ RaveValue NodeRet::generate() {
     RaveValue generated = value->generate();    
     RaveValue ptr = currScope->getWithoutLoad("return", loc);
 
-    if(generated.type->toString() == ptr.type->toString()) generated = LLVM::load(generated, "NodeRet_load", loc);
+    if(isSameType(generated.type, ptr.type)) generated = LLVM::load(generated, "NodeRet_load", loc);
 
     LLVMBuildStore(generator->builder, generated.value, ptr.value);
 
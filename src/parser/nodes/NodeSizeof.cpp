@@ -10,6 +10,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/nodes/NodeType.hpp"
 
 NodeSizeof::NodeSizeof(Node* value, int loc) {
+    this->kind = Kind;
     this->value = value;
     this->loc = loc;
 }
@@ -21,6 +21,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/llvm.hpp"
 
 NodeSlice::NodeSlice(Node* base, Node* start, Node* end, int loc) {
+    this->kind = Kind;
     this->base = base;
     this->start = start;
     this->end = end;
@@ -28,15 +29,15 @@ NodeSlice::NodeSlice(Node* base, Node* start, Node* end, int loc) {
 }
 
 Type* NodeSlice::getType() {
-    if(!instanceof<NodeInt>(start) || !instanceof<NodeInt>(end)) return new TypePointer(base->getType());
+    if(!instanceof<NodeInt>(start) || !instanceof<NodeInt>(end)) return getPointerType(base->getType());
     BigInt one = ((NodeInt*)start)->value;
     BigInt two = ((NodeInt*)end)->value;
     if((two <= one) || (one < 0) || (instanceof<TypeArray>(base->getType()) && ((NodeInt*)((TypeArray*)base->getType())->count->comptime())->value.to_int() < two.to_int())) generator->error("incorrect slice values!", loc);
-    return new TypeArray(new NodeInt(two.to_int() - one.to_int()), base->getType());
+    return getArrayType(new NodeInt(two.to_int() - one.to_int()), base->getType());
 }
 
 Node* NodeSlice::comptime() {return this;}
-Node* NodeSlice::copy() {return new NodeSlice(this->base, this->start, this->end, this->loc);}
+Node* NodeSlice::copy() {return new NodeSlice(this->base->copy(), this->start->copy(), this->end->copy(), this->loc);}
 void NodeSlice::check() {this->isChecked = true;}
 
 NodeSlice::~NodeSlice() {
@@ -86,8 +87,10 @@ RaveValue NodeSlice::generate() {
 
         RaveValue sizeOf = (new NodeInt(typeSize / 8))->generate();
 
+        // The buffer is allocated as char*, that is shared by all files of the thread, so the pointer is cast instead of changing its type
         RaveValue buffer = LLVM::alloc(LLVM::mul(sliceSize, sizeOf), "NodeSlice_dynbuffer");
-        ((TypePointer*)buffer.type)->instance = elType;
+        buffer.type = getPointerType(elType);
+        buffer.value = LLVMBuildPointerCast(generator->builder, buffer.value, generator->genType(buffer.type, loc), "NodeSlice_dynbuffer_cast");
 
         NodeFor* _for = new NodeFor(
             {
@@ -126,7 +129,7 @@ RaveValue NodeSlice::generate() {
                     std::vector<Node*>({base, new NodeInt(0)})
                 );
 
-                RaveValue buffer = LLVM::alloc(new TypeArray(new NodeInt(two - one), call->getType()), "NodeSlice_buffer");
+                RaveValue buffer = LLVM::alloc(getArrayType(new NodeInt(two - one), call->getType()), "NodeSlice_buffer");
                 RaveValue tempBuffer = LLVM::load(buffer, "load", loc);
 
                 for(int i=one, j=0; i<two; i++, j++) {
@@ -139,7 +142,7 @@ RaveValue NodeSlice::generate() {
         }
     }
 
-    RaveValue buffer = LLVM::alloc(new TypeArray(new NodeInt(two - one), lBase.type->getElType()), "NodeSlice_buffer");
+    RaveValue buffer = LLVM::alloc(getArrayType(new NodeInt(two - one), lBase.type->getElType()), "NodeSlice_buffer");
     RaveValue tempBuffer = LLVM::load(buffer, "load", loc);
 
     if(instanceof<TypeArray>(lBase.type)) for(int i=one, j=0; i<two; i++, j++) {
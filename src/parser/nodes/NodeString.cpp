@@ -11,12 +11,13 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/llvm.hpp"
 
 NodeString::NodeString(std::string value, bool isWide) {
+    this->kind = Kind;
     this->value = value;
     this->isWide = isWide;
 }
 
 Node* NodeString::copy() {return new NodeString(this->value, this->isWide);}
-Type* NodeString::getType() {return new TypePointer(basicTypes[isWide ? BasicType::Uint : BasicType::Char]);}
+Type* NodeString::getType() {return getPointerType(basicTypes[isWide ? BasicType::Uint : BasicType::Char]);}
 Node* NodeString::comptime() {return this;}
 void NodeString::check() {this->isChecked = true;}
 
@@ -40,7 +41,7 @@ RaveValue NodeString::generate() {
 
     LLVMValueRef indices[2] = {LLVM::makeInt(32, 0, false), LLVM::makeInt(32, 0, false)};
 
-    Type* tp = new TypePointer(basicTypes[isWide ? BasicType::Int : BasicType::Char]);
+    Type* tp = getPointerType(basicTypes[isWide ? BasicType::Int : BasicType::Char]);
 
     return {LLVM::cInboundsGep({globalStr, tp}, indices, 2).value, tp};
 }
\ No newline at end of file
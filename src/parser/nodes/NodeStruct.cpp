@@ -24,9 +24,11 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/nodes/NodeBuiltin.hpp"
 #include "../../include/parser/nodes/NodeBool.hpp"
 #include "../../include/parser/ast.hpp"
+#include "../../include/timetrace.hpp"
 #include <algorithm>
 
 NodeStruct::NodeStruct(std::string name, std::vector<Node*> elements, int loc, std::string extends, std::vector<std::string> templateNames, std::vector<DeclarMod> mods) {
+    this->kind = Kind;
     this->name = name;
     this->origname = name;
     this->oldElements = elements;
@@ -221,10 +223,14 @@ std::vector<LLVMTypeRef> NodeStruct::getParameters(bool isLinkOnce) {
                     if(sTypes != types) {
                         func->origName += types;
                         AST::methodTable[std::pair<std::string, std::string>(this->name, func->origName)] = func;
+                        AST::addMethodOverload(this->name, func->origName);
                     }
                     else generator->error("method '" + func->origName + "' has already been declared on " + std::to_string(AST::methodTable[std::pair<std::string, std::string>(this->name, func->origName)]->loc) + " line!", this->loc);
                 }
-                else AST::methodTable[std::pair<std::string, std::string>(this->name, func->origName)] = func;
+                else {
+                    AST::methodTable[std::pair<std::string, std::string>(this->name, func->origName)] = func;
+                    AST::addMethodOverload(this->name, func->origName);
+                }
                 this->methods.push_back(func);
             }
         }
@@ -381,12 +387,13 @@ RaveValue NodeStruct::generate() {
 
 LLVMTypeRef NodeStruct::genWithTemplate(std::string sTypes, std::vector<Type*> types) {
     if(templateNames.size() == 0) return nullptr;
+    TimeTrace::Scope traceScope("Template", this->name + sTypes);
 
     std::map<int32_t, Loop> activeLoops = std::map<int32_t, Loop>(generator->activeLoops);
     LLVMBuilderRef builder = generator->builder;
     LLVMBasicBlockRef currBB = generator->currBB;
     Scope* _scope = currScope;
-    std::map<std::string, Type*> toReplace = std::map<std::string, Type*>(generator->toReplace);
+    SymbolTable<std::string, Type*> toReplace = generator->toReplace;
     std::map<std::string, Node*> toReplaceValues = std::map<std::string, Node*>(generator->toReplaceValues);
 
     std::string _fn = "<";
@@ -446,7 +453,7 @@ LLVMTypeRef NodeStruct::genWithTemplate(std::string sTypes, std::vector<Type*> t
     generator->builder = builder;
     generator->currBB = currBB;
     currScope = _scope;
-    generator->toReplace = std::map<std::string, Type*>(toReplace);
+    generator->toReplace = toReplace;
     generator->toReplaceValues = std::map<std::string, Node*>(toReplaceValues);
 
     return generator->structures[_struct->name];
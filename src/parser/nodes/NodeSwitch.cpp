@@ -10,9 +10,16 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/nodes/NodeBinary.hpp"
 #include "../../include/parser/nodes/NodeFunc.hpp"
 #include "../../include/parser/nodes/NodeIf.hpp"
+#include "../../include/parser/nodes/NodeInt.hpp"
+#include "../../include/parser/nodes/NodeChar.hpp"
+#include "../../include/parser/nodes/NodeUnary.hpp"
+#include "../../include/parser/ast.hpp"
 #include "../../include/utils.hpp"
+#include "../../include/llvm.hpp"
+#include <set>
 
 NodeSwitch::NodeSwitch(Node* expr, Node* _default, std::vector<std::pair<std::vector<Node*>, Node*>> statements, int loc) {
+    this->kind = Kind;
     this->expr = expr;
     this->statements = statements;
     this->loc = loc;
@@ -44,6 +51,11 @@ RaveValue NodeSwitch::generate() {
         return {};
     }
 
+    if(isConstant()) {
+        generateSwitch();
+        return {};
+    }
+
     std::vector<NodeIf*> ifVector;
     ifVector.reserve(statements.size());
 
@@ -65,11 +77,106 @@ RaveValue NodeSwitch::generate() {
     return {};
 }
 
+static bool isConstantCase(Node* node) {
+    if(instanceof<NodeInt>(node) || instanceof<NodeChar>(node)) return true;
+    return instanceof<NodeUnary>(node) && ((NodeUnary*)node)->type == TokType::Minus && instanceof<NodeInt>(((NodeUnary*)node)->base);
+}
+
+bool NodeSwitch::isConstant() {
+    Type* exprType = expr->getType();
+    if(!instanceof<TypeBasic>(exprType) || ((TypeBasic*)exprType)->isFloat()) return false;
+
+    for(const auto& statement : statements) {
+        for(Node* value : statement.first) {
+            if(!isConstantCase(value)) return false;
+        }
+    }
+
+    return true;
+}
+
+// Integer switch with constant cases: the value is computed once and LLVM can turn the switch into a jump table.
+void NodeSwitch::generateSwitch() {
+    RaveValue value = expr->generate();
+    LLVMTypeRef valueType = LLVMTypeOf(value.value);
+    bool isUnsigned = ((TypeBasic*)expr->getType())->isUnsigned();
+
+    LLVMBasicBlockRef defaultBlock = LLVM::makeBlock("default", currScope->funcName);
+    LLVMBasicBlockRef endBlock = LLVM::makeBlock("end", currScope->funcName);
+
+    std::vector<LLVMBasicBlockRef> blocks;
+    blocks.reserve(statements.size());
+
+    unsigned casesCount = 0;
+    for(const auto& statement : statements) casesCount += statement.first.size();
+
+    LLVMValueRef _switch = LLVMBuildSwitch(generator->builder, value.value, defaultBlock, casesCount);
+
+    // The first matching case wins, so the repeated values are skipped as in the chain of conditions
+    std::set<unsigned long long> added;
+
+    for(const auto& statement : statements) {
+        blocks.push_back(LLVM::makeBlock("case", currScope->funcName));
+
+        for(Node* caseNode : statement.first) {
+            Node* node = caseNode->comptime();
+            LLVMValueRef constant = node->generate().value;
+            LLVMValueRef caseValue = LLVMConstIntCast(constant, valueType, !isUnsigned);
+
+            // The value, that is changed by the cast, can never be equal to the expression: the case is skipped
+            if(LLVMConstIntGetSExtValue(LLVMConstIntCast(caseValue, LLVMTypeOf(constant), !isUnsigned)) != LLVMConstIntGetSExtValue(constant)) {
+                if(!generator->settings.disableWarnings) generator->warning("the case value " + std::to_string(LLVMConstIntGetSExtValue(constant)) + " does not fit into the type '" + expr->getType()->toString() + "' of switch and is skipped!", loc);
+                continue;
+            }
+
+            if(added.insert(LLVMConstIntGetZExtValue(caseValue)).second) LLVMAddCase(_switch, caseValue, blocks.back());
+        }
+    }
+
+    bool allEnds = (_default != nullptr);
+
+    for(size_t i=0; i<=statements.size(); i++) {
+        Node* body = (i < statements.size()) ? statements[i].second : _default;
+        LLVMBasicBlockRef block = (i < statements.size()) ? blocks[i] : defaultBlock;
+
+        int selfNum = generator->activeLoops.size();
+        generator->activeLoops[selfNum] = Loop{.isActive = true, .start = block, .end = endBlock, .hasEnd = false, .isIf = true, .loopRets = std::vector<LoopReturn>(), .owner = this};
+
+        LLVM::Builder::atEnd(block);
+        currScope->push();
+
+        if(body != nullptr) {
+            body->check();
+            body->generate();
+        }
+
+        // 'continue' marks the loop itself, so the terminator of the current block is checked too
+        if(!generator->activeLoops[selfNum].hasEnd && LLVMGetBasicBlockTerminator(LLVMGetInsertBlock(generator->builder)) == nullptr) {
+            LLVMBuildBr(generator->builder, endBlock);
+            allEnds = false;
+        }
+
+        generator->activeLoops.erase(selfNum);
+        currScope->pop();
+    }
+
+    LLVM::Builder::atEnd(endBlock);
+
+    if(allEnds && generator->activeLoops.size() == 0) LLVMBuildRet(generator->builder, LLVMConstNull(generator->genType(AST::funcTable[currScope->funcName]->type, this->loc)));
+}
+
 Node* NodeSwitch::comptime() {return this;}
 
 Node* NodeSwitch::copy() {
+    std::vector<std::pair<std::vector<Node*>, Node*>> cStatements;
+    for(int i=0; i<this->statements.size(); i++) {
+        std::vector<Node*> cases;
+        for(int j=0; j<this->statements[i].first.size(); j++) cases.push_back(this->statements[i].first[j]->copy());
+        cStatements.push_back({cases, (this->statements[i].second == nullptr ? nullptr : this->statements[i].second->copy())});
+    }
+
     return new NodeSwitch(
         this->expr->copy(), (this->_default == nullptr ? nullptr : this->_default->copy()),
-        std::vector<std::pair<std::vector<Node*>, Node*>>(this->statements), this->loc
+        cStatements, this->loc
     );
 }
\ No newline at end of file
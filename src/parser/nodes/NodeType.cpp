@@ -7,6 +7,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/parser/nodes/NodeType.hpp"
 
 NodeType::NodeType(Type* type, int loc) {
+    this->kind = Kind;
     this->type = type;
     this->loc = loc;
 }
@@ -23,6 +23,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/llvm.hpp"
 
 NodeUnary::NodeUnary(int loc, char type, Node* base) {
+    this->kind = Kind;
     this->loc = loc;
     this->type = type;
     this->base = base;
@@ -35,8 +36,8 @@ NodeUnary::~NodeUnary() {
 Type* NodeUnary::getType() {
     switch(this->type) {
         case TokType::GetPtr:
-            if(instanceof<TypeArray>(this->base->getType())) return new TypePointer(this->base->getType()->getElType());
-            return new TypePointer(this->base->getType());
+            if(instanceof<TypeArray>(this->base->getType())) return getPointerType(this->base->getType()->getElType());
+            return getPointerType(this->base->getType());
         case TokType::Minus: case TokType::Ne: return this->base->getType();
         case TokType::Destructor: return typeVoid;
         case TokType::Multiply:
@@ -118,7 +119,7 @@ RaveValue NodeUnary::generate() {
             }
             else {
                 // if we are in local scope, make this variable marked as used
-                if(currScope->localVars.find(id->name) != currScope->localVars.end()) currScope->localVars[id->name]->isUsed = true;
+                currScope->markUsed(id->name);
 
                 // if it's array, generate gep to its first element
                 if(instanceof<TypeArray>(currScope->getVar(id->name, this->loc)->type)) {
@@ -23,6 +23,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/llvm.hpp"
 
 NodeVar::NodeVar(std::string name, Node* value, bool isExtern, bool isConst, bool isGlobal, std::vector<DeclarMod> mods, int loc, Type* type, bool isVolatile) {
+    this->kind = Kind;
     this->name = name;
     this->origName = name;
     this->linkName = this->name;
@@ -43,6 +44,7 @@ NodeVar::NodeVar(std::string name, Node* value, bool isExtern, bool isConst, boo
 }
 
 NodeVar::NodeVar(std::string name, Node* value, bool isExtern, bool isConst, bool isGlobal, std::vector<DeclarMod> mods, int loc, Type* type, bool isVolatile, bool isChanged, bool noZeroInit) {
+    this->kind = Kind;
     this->name = name;
     this->origName = name;
     this->linkName = this->name;
@@ -118,7 +120,7 @@ RaveValue NodeVar::generate() {
     }
 
     if(instanceof<TypeAlias>(this->type)) {
-        if(currScope != nullptr) currScope->aliasTable[this->name] = this->value;
+        if(currScope != nullptr) currScope->setAlias(this->name, this->value);
         else AST::aliasTable[this->name] = this->value;
         return {};
     }
@@ -144,6 +146,7 @@ RaveValue NodeVar::generate() {
         this->isUsed = true; // Maybe rework it?
 
         bool noMangling = false;
+        bool isThreadLocal = false;
 
         for(int i=0; i<this->mods.size(); i++) {
             while(AST::aliasTable.find(this->mods[i].name) != AST::aliasTable.end()) {
@@ -167,6 +170,7 @@ RaveValue NodeVar::generate() {
                 alignment = ((NodeInt*)(mods[i].value))->value.to_int();
             }
             else if(mods[i].name == "nozeroinit") noZeroInit = true;
+            else if(mods[i].name == "threadlocal") isThreadLocal = true;
         }
 
         if(!instanceof<TypeAuto>(this->type)) {
@@ -183,7 +187,7 @@ RaveValue NodeVar::generate() {
                 generator->lModule,
                 globalType,
                 linkName.c_str()
-            ), new TypePointer(this->type)};
+            ), getPointerType(this->type)};
 
             if(!isExtern) {
                 if(value != nullptr) LLVMSetInitializer(generator->globals[name].value, this->value->generate().value);
@@ -204,7 +208,7 @@ RaveValue NodeVar::generate() {
                 generator->lModule,
                 LLVMTypeOf(val.value),
                 linkName.c_str()
-            ), new TypePointer(val.type)};
+            ), getPointerType(val.type)};
 
             this->type = value->getType();
 
@@ -215,6 +219,7 @@ RaveValue NodeVar::generate() {
             else if(!instanceof<TypeVector>(this->type)) LLVMSetAlignment(generator->globals[this->name].value, generator->getAlignment(this->type));
 
             if(isVolatile) LLVMSetVolatile(generator->globals[name].value, true);
+            if(isThreadLocal) LLVMSetThreadLocal(generator->globals[name].value, true);
 
             return {};
         }
@@ -228,6 +233,7 @@ RaveValue NodeVar::generate() {
         else if(isExtern) LLVMSetLinkage(generator->globals[this->name].value, LLVMExternalLinkage);
 
         if(isVolatile) LLVMSetVolatile(generator->globals[this->name].value, true);
+        if(isThreadLocal) LLVMSetThreadLocal(generator->globals[this->name].value, true);
 
         if(alignment != -1) LLVMSetAlignment(generator->globals[this->name].value, alignment);
         else if(!instanceof<TypeVector>(this->type)) LLVMSetAlignment(generator->globals[this->name].value, generator->getAlignment(this->type));
@@ -251,7 +257,7 @@ RaveValue NodeVar::generate() {
             else if(mods[i].name == "nozeroinit") noZeroInit = true;
         }
 
-        currScope->localVars[this->name] = this;
+        currScope->setVar(this->name, this);
 
         if(instanceof<TypeAuto>(this->type)) {
             if(instanceof<NodeCall>(this->value)) {
@@ -283,52 +289,52 @@ RaveValue NodeVar::generate() {
                     }
                     else {
                         RaveValue val = this->value->generate();
-                        currScope->localScope[this->name] = LLVM::alloc(val.type, name.c_str());
+                        currScope->setLocal(this->name, LLVM::alloc(val.type, name.c_str()));
                         this->type = value->getType();
 
-                        if(isVolatile) LLVMSetVolatile(currScope->localScope[this->name].value, true);
+                        if(isVolatile) LLVMSetVolatile(currScope->getLocal(this->name).value, true);
 
                         if(alignment != -1) LLVMSetAlignment(generator->globals[this->name].value, alignment);
-                        else if(!instanceof<TypeVector>(this->type)) LLVMSetAlignment(currScope->localScope[this->name].value, generator->getAlignment(this->type));
+                        else if(!instanceof<TypeVector>(this->type)) LLVMSetAlignment(currScope->getLocal(this->name).value, generator->getAlignment(this->type));
                         
-                        LLVMBuildStore(generator->builder, val.value, currScope->localScope[this->name].value);
+                        LLVMBuildStore(generator->builder, val.value, currScope->getLocal(this->name).value);
 
-                        return currScope->localScope[this->name];
+                        return currScope->getLocal(this->name);
                     }
                 }
                 else {
                     RaveValue val = this->value->generate();
-                    currScope->localScope[this->name] = LLVM::alloc(val.type, name.c_str());
+                    currScope->setLocal(this->name, LLVM::alloc(val.type, name.c_str()));
                     this->type = value->getType();
 
-                    if(isVolatile) LLVMSetVolatile(currScope->localScope[this->name].value, true);
+                    if(isVolatile) LLVMSetVolatile(currScope->getLocal(this->name).value, true);
 
                     if(alignment != -1) LLVMSetAlignment(generator->globals[this->name].value, alignment);
-                    else if(!instanceof<TypeVector>(this->type)) LLVMSetAlignment(currScope->localScope[this->name].value, generator->getAlignment(this->type));
+                    else if(!instanceof<TypeVector>(this->type)) LLVMSetAlignment(currScope->getLocal(this->name).value, generator->getAlignment(this->type));
 
-                    LLVMBuildStore(generator->builder, val.value, currScope->localScope[this->name].value);
+                    LLVMBuildStore(generator->builder, val.value, currScope->getLocal(this->name).value);
 
-                    return currScope->localScope[this->name];
+                    return currScope->getLocal(this->name);
                 }
             }
             else {
                 RaveValue val = this->value->generate();
-                currScope->localScope[this->name] = LLVM::alloc(val.type, name.c_str());
+                currScope->setLocal(this->name, LLVM::alloc(val.type, name.c_str()));
                 this->type = value->getType();
-                if(isVolatile) LLVMSetVolatile(currScope->localScope[this->name].value, true);
+                if(isVolatile) LLVMSetVolatile(currScope->getLocal(this->name).value, true);
                 if(alignment != -1) LLVMSetAlignment(generator->globals[this->name].value, alignment);
-                else if(!instanceof<TypeVector>(this->type)) LLVMSetAlignment(currScope->localScope[this->name].value, generator->getAlignment(this->type));
-                LLVMBuildStore(generator->builder, val.value, currScope->localScope[this->name].value);
-                return currScope->localScope[this->name];
+                else if(!instanceof<TypeVector>(this->type)) LLVMSetAlignment(currScope->getLocal(this->name).value, generator->getAlignment(this->type));
+                LLVMBuildStore(generator->builder, val.value, currScope->getLocal(this->name).value);
+                return currScope->getLocal(this->name);
             }
         }
 
         if(instanceof<NodeInt>(this->value) && !isFloatType(this->type)) ((NodeInt*)this->value)->isVarVal = this->type;
 
         LLVMTypeRef gT = generator->genType(this->type, this->loc);
-        currScope->localScope[this->name] = LLVM::alloc(this->type, name.c_str());
+        currScope->setLocal(this->name, LLVM::alloc(this->type, name.c_str()));
 
-        if(isVolatile) LLVMSetVolatile(currScope->localScope[this->name].value, true);
+        if(isVolatile) LLVMSetVolatile(currScope->getLocal(this->name).value, true);
         if(alignment != -1) LLVMSetAlignment(generator->globals[this->name].value, alignment);
         else if(!instanceof<TypeVector>(this->type)) LLVMSetAlignment(currScope->getWithoutLoad(this->name, this->loc).value, generator->getAlignment(this->type));
 
@@ -346,9 +352,9 @@ RaveValue NodeVar::generate() {
         }
 
         if(this->value != nullptr) Binary::operation(TokType::Equ, new NodeIden(name, loc), value, loc);
-        else if((instanceof<TypeBasic>(type) || instanceof<TypePointer>(type)) && !noZeroInit) LLVMBuildStore(generator->builder, LLVMConstNull(gT), currScope->localScope[this->name].value);
+        else if((instanceof<TypeBasic>(type) || instanceof<TypePointer>(type)) && !noZeroInit) LLVMBuildStore(generator->builder, LLVMConstNull(gT), currScope->getLocal(this->name).value);
 
-        return currScope->localScope[this->name];
+        return currScope->getLocal(this->name);
     }
     return {};
 }
\ No newline at end of file
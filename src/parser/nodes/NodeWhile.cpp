@@ -17,6 +17,7 @@ with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "../../include/utils.hpp"
 
 NodeWhile::NodeWhile(Node* cond, Node* body, int loc) {
+    this->kind = Kind;
     this->cond = cond;
     this->body = body;
     this->loc = loc;
@@ -54,8 +55,7 @@ RaveValue NodeWhile::generate() {
         .isIf = false, .owner = this
     };
 
-    auto oldScope = currScope;
-    currScope = copyScope(currScope);
+    currScope->push();
 
     generator->currBB = whileBlock;
     this->body->generate();
@@ -66,8 +66,7 @@ RaveValue NodeWhile::generate() {
     generator->currBB = generator->activeLoops[selfNumber].end;
     generator->activeLoops.erase(selfNumber);
 
-    delete currScope;
-    currScope = oldScope;
+    currScope->pop();
 
     return {};
 }
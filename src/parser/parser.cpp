@@ -54,10 +54,11 @@ with this file, You can obtain one at htypep://mozilla.org/MPL/2.0/.
 #include "../include/parser/nodes/NodeConstStruct.hpp"
 #include "../include/parser/nodes/NodeSlice.hpp"
 #include "../include/parser/nodes/NodeComptime.hpp"
+#include "../include/compiler.hpp"
 #include <inttypes.h>
 #include <sstream>
 
-std::map<char, int> operators;
+thread_local std::map<char, int> operators;
 
 Parser::Parser(std::vector<Token*> tokens, std::string file) {
     this->tokens = tokens;
@@ -91,21 +92,21 @@ Parser::Parser(std::vector<Token*> tokens, std::string file) {
 }
 
 void Parser::error(std::string msg) {
-    std::cout << "\033[0;31mError in '" + this->file + "' file at " + std::to_string(this->peek()->line)+ " line: " + msg + "\033[0;0m" << std::endl;
-    std::exit(1);
+    Compiler::log() << "\033[0;31mError in '" + this->file + "' file at " + std::to_string(this->peek()->line)+ " line: " + msg + "\033[0;0m" << std::endl;
+    Compiler::exit(1);
 }
 
 void Parser::error(std::string msg, int line) {
-    std::cout << "\033[0;31mError in '" + this->file + "' file at " + std::to_string(line) + " line: " + msg + "\033[0;0m" << std::endl;
-    std::exit(1);
+    Compiler::log() << "\033[0;31mError in '" + this->file + "' file at " + std::to_string(line) + " line: " + msg + "\033[0;0m" << std::endl;
+    Compiler::exit(1);
 }
 
 void Parser::warning(std::string msg) {
-    std::cout << "\033[0;33mWarning in '" + this->file + "' file at "+  std::to_string(this->peek()->line) + " line: " + msg + "\033[0;0m" << std::endl;
+    Compiler::log() << "\033[0;33mWarning in '" + this->file + "' file at "+  std::to_string(this->peek()->line) + " line: " + msg + "\033[0;0m" << std::endl;
 }
 
 void Parser::warning(std::string msg, int line) {
-    std::cout << "\033[0;33mWarning in '" + this->file + "' file at " + std::to_string(line) + " line: " + msg + "\033[0;0m" << std::endl;
+    Compiler::log() << "\033[0;33mWarning in '" + this->file + "' file at " + std::to_string(line) + " line: " + msg + "\033[0;0m" << std::endl;
 }
 
 Token* Parser::peek() {return this->tokens[this->idx];}
@@ -907,7 +908,7 @@ Type* Parser::parseType(bool cannotBeTemplate, bool isDeclaration) {
         this->peek()->type == TokType::Multiply || this->peek()->type == TokType::Rarr ||
         this->peek()->type == TokType::Rpar || (this->peek()->type == TokType::Less && !cannotBeTemplate)
     ) {
-        if(this->peek()->type == TokType::Multiply) {this->next(); ty = new TypePointer(ty);}
+        if(this->peek()->type == TokType::Multiply) {this->next(); ty = getPointerType(ty);}
         else if(this->peek()->type == TokType::Rarr) {
             Node* count = nullptr;
             this->next();
@@ -918,7 +919,7 @@ Type* Parser::parseType(bool cannotBeTemplate, bool isDeclaration) {
             }
             else this->next();
 
-            ty = new TypeArray(count, ty);
+            ty = getArrayType(count, ty);
         }
         else if(this->peek()->type == TokType::Rpar) ty = new TypeFunc(ty, this->parseFuncArgs(), false);
         else {
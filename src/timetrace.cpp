@@ -0,0 +1,56 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "./include/timetrace.hpp"
+#include <llvm/Support/TimeProfiler.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/IR/PassInstrumentation.h>
+#include <iostream>
+
+bool TimeTrace::enabled = false;
+
+// Spans shorter than this (in microseconds) are dropped, otherwise the trace is flooded by the tiny passes
+unsigned TimeTrace::granularity = 50;
+
+void TimeTrace::initializeThread() {
+    if(enabled && llvm::getTimeTraceProfilerInstance() == nullptr) llvm::timeTraceProfilerInitialize(granularity, "rave");
+}
+
+void TimeTrace::finishThread() {
+    if(llvm::getTimeTraceProfilerInstance() != nullptr) llvm::timeTraceProfilerFinishThread();
+}
+
+// Called by the main thread after all workers were finished
+void TimeTrace::write(std::string const& file) {
+    if(llvm::getTimeTraceProfilerInstance() == nullptr) return;
+
+    std::error_code ec;
+    llvm::raw_fd_ostream out(file, ec, llvm::sys::fs::OF_Text);
+
+    if(ec) std::cout << "\033[0;31mError: cannot write the time trace to '" << file << "': " << ec.message() << "\033[0;0m" << std::endl;
+    else llvm::timeTraceProfilerWrite(out);
+
+    llvm::timeTraceProfilerCleanup();
+}
+
+void TimeTrace::registerPassCallbacks(llvm::PassInstrumentationCallbacks& callbacks) {
+    if(llvm::getTimeTraceProfilerInstance() == nullptr) return;
+
+    callbacks.registerBeforeNonSkippedPassCallback([](llvm::StringRef pass, llvm::Any) {llvm::timeTraceProfilerBegin(pass, "");});
+    callbacks.registerAfterPassCallback([](llvm::StringRef, llvm::Any, llvm::PreservedAnalyses const&) {llvm::timeTraceProfilerEnd();});
+    callbacks.registerAfterPassInvalidatedCallback([](llvm::StringRef, llvm::PreservedAnalyses const&) {llvm::timeTraceProfilerEnd();});
+}
+
+TimeTrace::Scope::Scope(const char* name, std::string const& detail) {
+    active = llvm::getTimeTraceProfilerInstance() != nullptr;
+    if(active) llvm::timeTraceProfilerBegin(name, detail);
+}
+
+void TimeTrace::Scope::end() {
+    if(active) llvm::timeTraceProfilerEnd();
+    active = false;
+}
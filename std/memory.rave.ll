@@ -0,0 +1,306 @@
+; ModuleID = 'rave'
+source_filename = "rave"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Function Attrs: nounwind readnone
+declare <4 x i32> @llvm.x86.ssse3.phadd.d.128(<4 x i32>, <4 x i32>) #0
+
+; Function Attrs: nounwind readnone
+declare <8 x i16> @llvm.x86.ssse3.phadd.sw.128(<8 x i16>, <8 x i16>) #0
+
+; Function Attrs: nounwind readnone
+declare <4 x float> @llvm.x86.sse3.hadd.ps(<4 x float>, <4 x float>) #0
+
+declare i8* @malloc(i32)
+
+declare void @free(i8*)
+
+declare i8* @realloc(i8*, i32)
+
+; Function Attrs: alwaysinline
+define i8* @"_RaveF11std::calloc"(i32 %0, i32 %1) #1 {
+entry:
+  %num = alloca i32, align 4
+  %size = alloca i32, align 4
+  %return = alloca i8*, align 8
+  store i8* null, i8** %return, align 8
+  store i32 %1, i32* %size, align 4
+  store i32 %0, i32* %num, align 4
+  %scopeGetLoad = load i32, i32* %num, align 4
+  %scopeGetLoad1 = load i32, i32* %size, align 4
+  %LLVM_mul = mul i32 %scopeGetLoad, %scopeGetLoad1
+  %callFunc = call i8* @malloc(i32 %LLVM_mul)
+  store i8* %callFunc, i8** %return, align 8
+  br label %exit
+
+exit:                                             ; preds = %entry
+  %scopeGetLoad2 = load i8*, i8** %return, align 8
+  ret i8* %scopeGetLoad2
+}
+
+; Function Attrs: alwaysinline
+define i8* @"_RaveF11std::memcpy"(i8* %0, i8* %1, i32 %2) #1 {
+entry:
+  %n = alloca i32, align 4
+  %return = alloca i8*, align 8
+  store i8* null, i8** %return, align 8
+  store i32 %2, i32* %n, align 4
+  %scopeGetLoad = load i32, i32* %n, align 4
+  %mem_size = sext i32 %scopeGetLoad to i64
+  call void @llvm.memcpy.p0i8.p0i8.i64(i8* align 1 %0, i8* align 1 %1, i64 %mem_size, i1 false)
+  store i8* %0, i8** %return, align 8
+  br label %exit
+
+exit:                                             ; preds = %entry
+  %scopeGetLoad1 = load i8*, i8** %return, align 8
+  ret i8* %scopeGetLoad1
+}
+
+; Function Attrs: argmemonly nofree nounwind willreturn
+declare void @llvm.memcpy.p0i8.p0i8.i64(i8* noalias nocapture writeonly, i8* noalias nocapture readonly, i64, i1 immarg) #2
+
+; Function Attrs: alwaysinline
+define i8* @"_RaveF12std::memmove"(i8* %0, i8* %1, i32 %2) #1 {
+entry:
+  %n = alloca i32, align 4
+  %return = alloca i8*, align 8
+  store i8* null, i8** %return, align 8
+  store i32 %2, i32* %n, align 4
+  %scopeGetLoad = load i32, i32* %n, align 4
+  %mem_size = sext i32 %scopeGetLoad to i64
+  call void @llvm.memmove.p0i8.p0i8.i64(i8* align 1 %0, i8* align 1 %1, i64 %mem_size, i1 false)
+  store i8* %0, i8** %return, align 8
+  br label %exit
+
+exit:                                             ; preds = %entry
+  %scopeGetLoad1 = load i8*, i8** %return, align 8
+  ret i8* %scopeGetLoad1
+}
+
+; Function Attrs: argmemonly nofree nounwind willreturn
+declare void @llvm.memmove.p0i8.p0i8.i64(i8* nocapture writeonly, i8* nocapture readonly, i64, i1 immarg) #2
+
+; Function Attrs: alwaysinline
+define i8* @"_RaveF11std::memset"(i8* %0, i32 %1, i32 %2) #1 {
+entry:
+  %c = alloca i32, align 4
+  %n = alloca i32, align 4
+  %return = alloca i8*, align 8
+  store i8* null, i8** %return, align 8
+  store i32 %2, i32* %n, align 4
+  store i32 %1, i32* %c, align 4
+  %scopeGetLoad = load i32, i32* %c, align 4
+  %scopeGetLoad1 = load i32, i32* %n, align 4
+  %mem_size = sext i32 %scopeGetLoad1 to i64
+  %mem_value = trunc i32 %scopeGetLoad to i8
+  call void @llvm.memset.p0i8.i64(i8* align 1 %0, i8 %mem_value, i64 %mem_size, i1 false)
+  store i8* %0, i8** %return, align 8
+  br label %exit
+
+exit:                                             ; preds = %entry
+  %scopeGetLoad2 = load i8*, i8** %return, align 8
+  ret i8* %scopeGetLoad2
+}
+
+; Function Attrs: argmemonly nofree nounwind willreturn writeonly
+declare void @llvm.memset.p0i8.i64(i8* nocapture writeonly, i8, i64, i1 immarg) #3
+
+define void @"_RaveF9std::swap"(i8* %0, i8* %1, i32 %2) {
+entry:
+  %old23 = alloca i8, align 1
+  %old = alloca i64, align 8
+  %pTwo = alloca i64*, align 8
+  %pOne = alloca i64*, align 8
+  %i = alloca i32, align 4
+  %size = alloca i32, align 4
+  store i32 %2, i32* %size, align 4
+  store i32 0, i32* %i, align 4
+  br label %cond
+
+cond:                                             ; preds = %while, %entry
+  %scopeGetLoad = load i32, i32* %i, align 4
+  %LLVM_sum = add i32 %scopeGetLoad, 8
+  %scopeGetLoad2 = load i32, i32* %size, align 4
+  %compareILE = icmp sle i32 %LLVM_sum, %scopeGetLoad2
+  br i1 %compareILE, label %while, label %exit1
+
+while:                                            ; preds = %cond
+  %scopeGetLoad3 = load i32, i32* %i, align 4
+  %gep3_byIndex = getelementptr i8, i8* %0, i32 %scopeGetLoad3
+  %NodeCast_ptop = bitcast i8* %gep3_byIndex to i64*
+  store i64* %NodeCast_ptop, i64** %pOne, align 8
+  %scopeGetLoad4 = load i32, i32* %i, align 4
+  %gep3_byIndex5 = getelementptr i8, i8* %1, i32 %scopeGetLoad4
+  %NodeCast_ptop6 = bitcast i8* %gep3_byIndex5 to i64*
+  store i64* %NodeCast_ptop6, i64** %pTwo, align 8
+  %scopeGetLoad7 = load i64*, i64** %pOne, align 8
+  %gep3_byIndex8 = getelementptr i64, i64* %scopeGetLoad7, i32 0
+  %NodeIndex_NodeIden_load_36_ = load i64, i64* %gep3_byIndex8, align 8
+  store i64 %NodeIndex_NodeIden_load_36_, i64* %old, align 8
+  %scopeGetLoad9 = load i64*, i64** %pOne, align 8
+  %gep3_byIndex10 = getelementptr i64, i64* %scopeGetLoad9, i32 0
+  %scopeGetLoad11 = load i64*, i64** %pTwo, align 8
+  %gep3_byIndex12 = getelementptr i64, i64* %scopeGetLoad11, i32 0
+  %NodeIndex_NodeIden_load_37_ = load i64, i64* %gep3_byIndex12, align 8
+  store i64 %NodeIndex_NodeIden_load_37_, i64* %gep3_byIndex10, align 8
+  %scopeGetLoad13 = load i64*, i64** %pTwo, align 8
+  %gep3_byIndex14 = getelementptr i64, i64* %scopeGetLoad13, i32 0
+  %scopeGetLoad15 = load i64, i64* %old, align 8
+  store i64 %scopeGetLoad15, i64* %gep3_byIndex14, align 8
+  %scopeGetLoad16 = load i32, i32* %i, align 4
+  %LLVM_sum17 = add i32 %scopeGetLoad16, 8
+  store i32 %LLVM_sum17, i32* %i, align 4
+  br label %cond
+
+exit1:                                            ; preds = %cond
+  br label %cond18
+
+cond18:                                           ; preds = %while19, %exit1
+  %scopeGetLoad21 = load i32, i32* %i, align 4
+  %scopeGetLoad22 = load i32, i32* %size, align 4
+  %compareILS = icmp slt i32 %scopeGetLoad21, %scopeGetLoad22
+  br i1 %compareILS, label %while19, label %exit20
+
+while19:                                          ; preds = %cond18
+  %scopeGetLoad24 = load i32, i32* %i, align 4
+  %gep3_byIndex25 = getelementptr i8, i8* %0, i32 %scopeGetLoad24
+  %NodeIndex_NodeIden_load_43_ = load i8, i8* %gep3_byIndex25, align 1
+  store i8 %NodeIndex_NodeIden_load_43_, i8* %old23, align 1
+  %scopeGetLoad26 = load i32, i32* %i, align 4
+  %gep3_byIndex27 = getelementptr i8, i8* %0, i32 %scopeGetLoad26
+  %scopeGetLoad28 = load i32, i32* %i, align 4
+  %gep3_byIndex29 = getelementptr i8, i8* %1, i32 %scopeGetLoad28
+  %NodeIndex_NodeIden_load_44_ = load i8, i8* %gep3_byIndex29, align 1
+  store i8 %NodeIndex_NodeIden_load_44_, i8* %gep3_byIndex27, align 1
+  %scopeGetLoad30 = load i32, i32* %i, align 4
+  %gep3_byIndex31 = getelementptr i8, i8* %1, i32 %scopeGetLoad30
+  %scopeGetLoad32 = load i8, i8* %old23, align 1
+  store i8 %scopeGetLoad32, i8* %gep3_byIndex31, align 1
+  %scopeGetLoad33 = load i32, i32* %i, align 4
+  %LLVM_sum34 = add i32 %scopeGetLoad33, 1
+  store i32 %LLVM_sum34, i32* %i, align 4
+  br label %cond18
+
+exit20:                                           ; preds = %cond18
+  br label %exit
+
+exit:                                             ; preds = %exit20
+  ret void
+}
+
+define i32 @"_RaveF11std::memcmp"(i8* %0, i8* %1, i32 %2) {
+entry:
+  %same = alloca i1, align 1
+  %i = alloca i32, align 4
+  %n = alloca i32, align 4
+  %return = alloca i32, align 4
+  store i32 0, i32* %return, align 4
+  store i32 %2, i32* %n, align 4
+  store i32 0, i32* %return, align 4
+  store i32 0, i32* %i, align 4
+  store i1 true, i1* %same, align 1
+  br label %cond
+
+cond:                                             ; preds = %elseIfEnd, %entry
+  %scopeGetLoad = load i1, i1* %same, align 1
+  br i1 %scopeGetLoad, label %while, label %exit1
+
+while:                                            ; preds = %cond
+  %scopeGetLoad2 = load i32, i32* %i, align 4
+  %LLVM_sum = add i32 %scopeGetLoad2, 8
+  %scopeGetLoad3 = load i32, i32* %n, align 4
+  %compareIMR = icmp sgt i32 %LLVM_sum, %scopeGetLoad3
+  br i1 %compareIMR, label %then, label %else
+
+exit1:                                            ; preds = %cond
+  br label %cond15
+
+then:                                             ; preds = %while
+  store i1 false, i1* %same, align 1
+  br label %elseIfEnd
+
+else:                                             ; preds = %while
+  %scopeGetLoad6 = load i32, i32* %i, align 4
+  %gep3_byIndex = getelementptr i8, i8* %0, i32 %scopeGetLoad6
+  %NodeCast_ptop = bitcast i8* %gep3_byIndex to i64*
+  %gep3_byIndex7 = getelementptr i64, i64* %NodeCast_ptop, i32 0
+  %NodeIndex_NodeCast_load = load i64, i64* %gep3_byIndex7, align 8
+  %scopeGetLoad8 = load i32, i32* %i, align 4
+  %gep3_byIndex9 = getelementptr i8, i8* %1, i32 %scopeGetLoad8
+  %NodeCast_ptop10 = bitcast i8* %gep3_byIndex9 to i64*
+  %gep3_byIndex11 = getelementptr i64, i64* %NodeCast_ptop10, i32 0
+  %NodeIndex_NodeCast_load12 = load i64, i64* %gep3_byIndex11, align 8
+  %compareINEQ = icmp ne i64 %NodeIndex_NodeCast_load, %NodeIndex_NodeCast_load12
+  br i1 %compareINEQ, label %then4, label %else5
+
+elseIfEnd:                                        ; preds = %end, %then
+  br label %cond
+
+then4:                                            ; preds = %else
+  store i1 false, i1* %same, align 1
+  br label %end
+
+else5:                                            ; preds = %else
+  %scopeGetLoad13 = load i32, i32* %i, align 4
+  %LLVM_sum14 = add i32 %scopeGetLoad13, 8
+  store i32 %LLVM_sum14, i32* %i, align 4
+  br label %end
+
+end:                                              ; preds = %else5, %then4
+  br label %elseIfEnd
+
+cond15:                                           ; preds = %end22, %exit1
+  %scopeGetLoad18 = load i32, i32* %i, align 4
+  %scopeGetLoad19 = load i32, i32* %n, align 4
+  %compareILS = icmp slt i32 %scopeGetLoad18, %scopeGetLoad19
+  br i1 %compareILS, label %while16, label %exit17
+
+while16:                                          ; preds = %cond15
+  %scopeGetLoad23 = load i32, i32* %i, align 4
+  %gep3_byIndex24 = getelementptr i8, i8* %0, i32 %scopeGetLoad23
+  %NodeIndex_NodeIden_load_64_ = load i8, i8* %gep3_byIndex24, align 1
+  %scopeGetLoad25 = load i32, i32* %i, align 4
+  %gep3_byIndex26 = getelementptr i8, i8* %1, i32 %scopeGetLoad25
+  %NodeIndex_NodeIden_load_64_27 = load i8, i8* %gep3_byIndex26, align 1
+  %compareINEQ28 = icmp ne i8 %NodeIndex_NodeIden_load_64_, %NodeIndex_NodeIden_load_64_27
+  br i1 %compareINEQ28, label %then20, label %else21
+
+exit17:                                           ; preds = %cond15
+  br label %exit
+
+then20:                                           ; preds = %while16
+  %scopeGetLoad29 = load i32, i32* %i, align 4
+  %gep3_byIndex30 = getelementptr i8, i8* %0, i32 %scopeGetLoad29
+  %NodeIndex_NodeIden_load_65_ = load i8, i8* %gep3_byIndex30, align 1
+  %LLVM_itoicast = sext i8 %NodeIndex_NodeIden_load_65_ to i32
+  %NodeBinary_and = and i32 %LLVM_itoicast, 255
+  %scopeGetLoad31 = load i32, i32* %i, align 4
+  %gep3_byIndex32 = getelementptr i8, i8* %1, i32 %scopeGetLoad31
+  %NodeIndex_NodeIden_load_65_33 = load i8, i8* %gep3_byIndex32, align 1
+  %LLVM_itoicast34 = sext i8 %NodeIndex_NodeIden_load_65_33 to i32
+  %NodeBinary_and35 = and i32 %LLVM_itoicast34, 255
+  %LLVM_sub = sub i32 %NodeBinary_and, %NodeBinary_and35
+  store i32 %LLVM_sub, i32* %return, align 4
+  %scopeGetLoad36 = load i32, i32* %n, align 4
+  store i32 %scopeGetLoad36, i32* %i, align 4
+  br label %end22
+
+else21:                                           ; preds = %while16
+  %scopeGetLoad37 = load i32, i32* %i, align 4
+  %LLVM_sum38 = add i32 %scopeGetLoad37, 1
+  store i32 %LLVM_sum38, i32* %i, align 4
+  br label %end22
+
+end22:                                            ; preds = %else21, %then20
+  br label %cond15
+
+exit:                                             ; preds = %exit17
+  %scopeGetLoad39 = load i32, i32* %return, align 4
+  ret i32 %scopeGetLoad39
+}
+
+attributes #0 = { nounwind readnone }
+attributes #1 = { alwaysinline }
+attributes #2 = { argmemonly nofree nounwind willreturn }
+attributes #3 = { argmemonly nofree nounwind willreturn writeonly }